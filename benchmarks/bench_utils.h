@@ -0,0 +1,79 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+#include "wsn_data.h"
+#include "wsn_generator.h"
+
+// arguments of the benchmarks on generated instances: {n, density (% of the pairs of nodes), K}
+namespace bench
+{
+    struct Graph
+    {
+        std::vector<std::vector<double>> weight;
+        std::vector<std::vector<int>> is_connected;
+        int n;
+    };
+
+    /**
+     * @brief Sensor network of the instance generator (wsn_generator.h) with the radio range whose disk
+     * covers density of the area, so about density of the pairs of nodes are adjacent (less near the border)
+     *
+     * @param n is the number of nodes
+     * @param density is the expected fraction of adjacent pairs of nodes
+     * @param seed is the seed of the generator, the same seed gives the same network
+     * @return generator::SensorNetwork with the positions and the edges
+     */
+    inline generator::SensorNetwork random_network(int n, double density, unsigned long long seed)
+    {
+        generator::GeometricParams params;
+        params.n = n;
+        params.range = params.area * std::sqrt(density / M_PI);
+        params.seed = seed;
+
+        return generator::random_geometric(params);
+    }
+
+    /**
+     * @brief Weight and adjacency matrices of a network, as read by read_instance_wsn
+     *
+     * @param network is the generated network
+     * @return Graph with the weight and adjacency matrices
+     */
+    inline Graph to_graph(const generator::SensorNetwork &network)
+    {
+        int n = network.n;
+
+        Graph graph{std::vector<std::vector<double>>(n, std::vector<double>(n, 1000)),
+                    std::vector<std::vector<int>>(n, std::vector<int>(n, 0)), n};
+
+        for (auto &edge : network.edges)
+        {
+            graph.weight[edge.from][edge.to] = graph.weight[edge.to][edge.from] = edge.weight;
+            graph.is_connected[edge.from][edge.to] = graph.is_connected[edge.to][edge.from] = 1;
+        }
+
+        return graph;
+    }
+
+    /**
+     * @brief Instance on a generated network. A sparse network can have more components than
+     * number_trees, so the number of trees is at least the number of components (the instance is feasible)
+     *
+     * @param n is the number of nodes
+     * @param density is the expected fraction of adjacent pairs of nodes
+     * @param number_trees is the number of trees (sinks)
+     * @param seed is the seed of the generator
+     * @return WSN_data
+     */
+    inline WSN_data random_instance(int n, double density, int number_trees, unsigned long long seed = 0)
+    {
+        auto network = random_network(n, density, seed);
+        auto graph = to_graph(network);
+
+        return WSN_data(graph.weight, graph.is_connected, n, std::max(number_trees, generator::number_of_components(network)));
+    }
+} // namespace bench
@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <random>
+
+#include "bench_utils.h"
+#include "util_instance.h"
+#include "wsn_constructive_heur.h"
+#include "wsn_solution.h"
+
+// {n, density (%)}
+const std::vector<std::vector<int64_t>> graph_args = {{50, 200, 800, 2000}, {5, 20}};
+
+// {n, density (%), K}
+const std::vector<std::vector<int64_t>> instance_args = {{50, 200, 800}, {5, 20}, {1, 4}};
+
+static double density(const benchmark::State &state)
+{
+    return state.range(1) / 100.0;
+}
+
+static void BM_read_instance_wsn(benchmark::State &state)
+{
+    auto network = bench::random_network(state.range(0), density(state), 0);
+    auto path = (std::filesystem::temp_directory_path() /
+                 ("wsn_bench_" + std::to_string(state.range(0)) + "_" + std::to_string(state.range(1))))
+                    .string();
+
+    generator::write_network(network, path);
+
+    std::vector<std::vector<double>> weight;
+    std::vector<std::vector<int>> is_connected;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(read_instance_wsn(path + ".txt", weight, is_connected));
+    }
+
+    std::filesystem::remove(path + ".txt");
+    std::filesystem::remove(path + ".wsnb");
+}
+BENCHMARK(BM_read_instance_wsn)->ArgsProduct(graph_args)->Unit(benchmark::kMillisecond);
+
+static void BM_to_adj_list_out(benchmark::State &state)
+{
+    auto graph = bench::to_graph(bench::random_network(state.range(0), density(state), 0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(to_adj_list_out(graph.is_connected));
+    }
+}
+BENCHMARK(BM_to_adj_list_out)->ArgsProduct(graph_args)->Unit(benchmark::kMicrosecond);
+
+static void BM_to_adj_list_in(benchmark::State &state)
+{
+    auto graph = bench::to_graph(bench::random_network(state.range(0), density(state), 0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(to_adj_list_in(graph.is_connected));
+    }
+}
+BENCHMARK(BM_to_adj_list_in)->ArgsProduct(graph_args)->Unit(benchmark::kMicrosecond);
+
+static void BM_heuristic_build(benchmark::State &state)
+{
+    auto instance = bench::random_instance(state.range(0), density(state), state.range(2));
+    WSNConstructiveHeuristic heur(instance);
+
+    auto order = util::ordered_vec(instance.n);
+    std::shuffle(order.begin(), order.end(), std::default_random_engine(0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(heur.build(order));
+    }
+}
+BENCHMARK(BM_heuristic_build)->ArgsProduct(instance_args)->Unit(benchmark::kMicrosecond);
+
+static void BM_heuristic_solve(benchmark::State &state)
+{
+    auto instance = bench::random_instance(state.range(0), density(state), state.range(2));
+    WSNConstructiveHeuristic heur(instance);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(heur.solve(0));
+    }
+
+    state.counters["weight"] = heur.weight_of_solution();
+}
+BENCHMARK(BM_heuristic_solve)->ArgsProduct({{50, 200}, {5, 20}, {1, 4}})->Unit(benchmark::kMillisecond);
+
+static void BM_is_solution_valid(benchmark::State &state)
+{
+    auto instance = bench::random_instance(state.range(0), density(state), state.range(2));
+    WSNConstructiveHeuristic heur(instance);
+    auto sol = with_node_lists(heur.solve(0));
+
+    std::set<int> masters(sol.masters.begin(), sol.masters.end());
+    std::set<int> bridges(sol.bridges.begin(), sol.bridges.end());
+    auto adj_forest = adj_list_forest(sol.edges, instance);
+
+    bool valid = false;
+
+    for (auto _ : state)
+    {
+        valid = is_solution_valid(instance, adj_forest, masters, bridges);
+        benchmark::DoNotOptimize(valid);
+    }
+
+    state.counters["valid"] = valid;
+}
+BENCHMARK(BM_is_solution_valid)->ArgsProduct(instance_args)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.h"
+#include "all_models.h"
+
+// {n, density (%), K}
+const std::vector<std::vector<int64_t>> instance_args = {{20, 50, 100}, {5, 20}, {1, 4}};
+
+static void BM_build_model(benchmark::State &state, std::string model_name)
+{
+    auto instance = bench::random_instance(state.range(0), state.range(1) / 100.0, state.range(2));
+
+    for (auto _ : state)
+    {
+        // only the formulation measured is created, its constructor is not timed
+        state.PauseTiming();
+        auto model = create_model(model_name, instance);
+        state.ResumeTiming();
+
+        (*model).build_model();
+
+        state.PauseTiming();
+        (*model).env.end();
+        model.reset();
+        state.ResumeTiming();
+    }
+}
+
+int main(int argc, char **argv)
+{
+    // the names of the formulations are taken from the registered models
+    for (auto &[name, factory] : model_factories())
+    {
+        benchmark::RegisterBenchmark(("BM_build_model/" + name).c_str(), BM_build_model, name)
+            ->ArgsProduct(instance_args)
+            ->Unit(benchmark::kMillisecond);
+    }
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
@@ -35,69 +35,169 @@
 
 #include "models/WSN_arvore_rotulada_model_mtz.h"
 #include "models/WSN_arvore_rotulada_model_flow.h"
+#include "models/WSN_arvore_rotulada_model_lazy.h"
 
 #include "models/WSN_mcf_weight_arc.h"
 #include "models/WSN_repr_model_flow.h"
 #include "models/WSN_repr_model_mtz.h"
+#include "models/WSN_lagrangian.h"
+#include "models/WSN_benders.h"
+#include "models/WSN_column_generation.h"
 
 #include <limits>
+#include <map>
+#include <functional>
+
+// creates a model for an instance and an upper bound
+using ModelFactory = std::function<std::unique_ptr<WSN>(WSN_data &, double)>;
 
 /**
- * @brief Create a model runner and initialize with all models
+ * @brief Register the factory of a model
  *
- * @param instance is a problem instances
- * @return std::unique_ptr<ModelRunner<WSN>> is a pointer to the model runner
+ * @tparam T is the class of the model, it should inherit from WSN
+ * @param factories is the map from the name of the models to their factories
+ * @param name is the name associated with the model
  */
-std::unique_ptr<ModelRunner<WSN>> initialize_all_models(WSN_data &instance, double upper_bound = std::numeric_limits<double>::max())
+template <class T>
+void register_model(std::map<std::string, ModelFactory> &factories, std::string name)
 {
-    std::unique_ptr<ModelRunner<WSN>> model_runner = std::make_unique<ModelRunner<WSN>>();
+    if (factories.find(name) != factories.end())
+    {
+        throw std::invalid_argument("Registering a new model with an existing name.");
+    }
 
-    (*model_runner).insert_model(WSN_flow_model_3idx(instance, upper_bound), "FlowModel3idx");
+    factories[name] = [](WSN_data &instance, double upper_bound)
+    { return std::unique_ptr<WSN>(std::make_unique<T>(instance, upper_bound)); };
+}
+
+/**
+ * @brief Factories of all models by name. A factory builds only its model (and its IloEnv),
+ * so running one model does not create the environments of the others
+ *
+ * @return std::map<std::string, ModelFactory>
+ */
+std::map<std::string, ModelFactory> model_factories()
+{
+    std::map<std::string, ModelFactory> factories;
 
-    (*model_runner).insert_model(WSN_flow_model_1(instance, upper_bound), "FlowModel1");
-    (*model_runner).insert_model(WSN_flow_model_0_1(instance, upper_bound), "FlowModel0-1");
-    (*model_runner).insert_model(WSN_flow_model_2_1_base(instance, upper_bound), "FlowModel2-1-base");
-    (*model_runner).insert_model(WSN_flow_model_2_1(instance, upper_bound), "FlowModel2-1");
-    (*model_runner).insert_model(WSN_flow_model_2_1_sbc(instance, upper_bound), "FlowModel2-1-sbc");
+    register_model<WSN_flow_model_3idx>(factories, "FlowModel3idx");
+
+    register_model<WSN_flow_model_1>(factories, "FlowModel1");
+    register_model<WSN_flow_model_0_1>(factories, "FlowModel0-1");
+    register_model<WSN_flow_model_2_1_base>(factories, "FlowModel2-1-base");
+    register_model<WSN_flow_model_2_1>(factories, "FlowModel2-1");
+    register_model<WSN_flow_model_2_1_sbc>(factories, "FlowModel2-1-sbc");
 
     // #################### Tree weight as flow ##################
-    (*model_runner).insert_model(WSN_flow_model_3_base(instance, upper_bound), "FlowModel3-base");
-    (*model_runner).insert_model(WSN_flow_model_3_valid_ineq(instance, upper_bound), "FlowModel3-valid-ineq");
-    (*model_runner).insert_model(WSN_flow_model_3_testing_ineq(instance, upper_bound), "FlowModel3-testing-ineq");
-    (*model_runner).insert_model(WSN_flow_model_3_check_instance(instance, upper_bound), "check-instance");
+    register_model<WSN_flow_model_3_base>(factories, "FlowModel3-base");
+    register_model<WSN_flow_model_3_valid_ineq>(factories, "FlowModel3-valid-ineq");
+    register_model<WSN_flow_model_3_valid_ineq_sep>(factories, "FlowModel3-valid-ineq-sep");
+    register_model<WSN_flow_model_3_testing_ineq>(factories, "FlowModel3-testing-ineq");
+    register_model<WSN_flow_model_3_check_instance>(factories, "check-instance");
 
     // ####################### MTZ Models #######################
-    (*model_runner).insert_model(WSN_mtz_model(instance, upper_bound), "MTZ");
-    (*model_runner).insert_model(WSN_mtz_model_2(instance, upper_bound), "MTZ2");
-    (*model_runner).insert_model(WSN_mtz_model_2_1(instance, upper_bound), "MTZ2-1");
-    (*model_runner).insert_model(WSN_mtz_castro_andrade_2023(instance, upper_bound), "MTZ-castro2023");
-    (*model_runner).insert_model(WSN_mtz_castro_andrade_2023_sbpo(instance, upper_bound), "MTZ-sbpo");
-    (*model_runner).insert_model(WSN_mtz_castro_andrade_2023_bektas2014(instance, upper_bound), "MTZ-castro2023-bektas");
-    (*model_runner).insert_model(WSN_mtz_castro_andrade_2023_new_constraints(instance, upper_bound), "MTZ-castro2023-new-constr");
+    register_model<WSN_mtz_model>(factories, "MTZ");
+    register_model<WSN_mtz_model_2>(factories, "MTZ2");
+    register_model<WSN_mtz_model_2_1>(factories, "MTZ2-1");
+    register_model<WSN_mtz_castro_andrade_2023>(factories, "MTZ-castro2023");
+    register_model<WSN_mtz_castro_andrade_2023_sbpo>(factories, "MTZ-sbpo");
+    register_model<WSN_mtz_castro_andrade_2023_bektas2014>(factories, "MTZ-castro2023-bektas");
+    register_model<WSN_mtz_castro_andrade_2023_new_constraints>(factories, "MTZ-castro2023-new-constr");
 
     // ####################### MCF Models #######################
-    (*model_runner).insert_model(WSN_mcf_model_base(instance, upper_bound), "MCFModel-base");
-    (*model_runner).insert_model(WSN_mcf_model_mcf_valid(instance, upper_bound), "MCFModel-mcf-valid");
-    (*model_runner).insert_model(WSN_mcf_model_castro2023(instance, upper_bound), "MCFModel-castro2023");
-    (*model_runner).insert_model(WSN_mcf_model_adasme2023(instance, upper_bound), "MCFModel-adasme2023");
-    (*model_runner).insert_model(WSN_mcf_model(instance, upper_bound), "MCFModel");
-    (*model_runner).insert_model(WSN_mcf_model_weight_on_node(instance, upper_bound), "MCFModel-weight-node");
+    register_model<WSN_mcf_model_base>(factories, "MCFModel-base");
+    register_model<WSN_mcf_model_mcf_valid>(factories, "MCFModel-mcf-valid");
+    register_model<WSN_mcf_model_castro2023>(factories, "MCFModel-castro2023");
+    register_model<WSN_mcf_model_adasme2023>(factories, "MCFModel-adasme2023");
+    register_model<WSN_mcf_model>(factories, "MCFModel");
+    register_model<WSN_mcf_model_weight_on_node>(factories, "MCFModel-weight-node");
 
     // ----------------------- Alternative flows ----------------
-    (*model_runner).insert_model(WSN_mcf_weight_model_base(instance, upper_bound), "MCFModel-weightAsFlow-base");
-    (*model_runner).insert_model(WSN_mcf_weight_arc_model(instance, upper_bound), "MCF-weight-arc-Model");
+    register_model<WSN_mcf_weight_model_base>(factories, "MCFModel-weightAsFlow-base");
+    register_model<WSN_mcf_weight_arc_model>(factories, "MCF-weight-arc-Model");
 
     // ###################### Proxy Models ######################
-    (*model_runner).insert_model(WSN_repr_model_flow_base(instance, upper_bound), "REPR-flow-base");
-    (*model_runner).insert_model(WSN_repr_model_flow(instance, upper_bound), "REPR-flow");
-    (*model_runner).insert_model(WSN_repr_model_mtz_base(instance, upper_bound), "REPR-mtz-base");
-    (*model_runner).insert_model(WSN_repr_model_mtz(instance, upper_bound), "REPR-mtz");
+    register_model<WSN_repr_model_flow_base>(factories, "REPR-flow-base");
+    register_model<WSN_repr_model_flow>(factories, "REPR-flow");
+    register_model<WSN_repr_model_mtz_base>(factories, "REPR-mtz-base");
+    register_model<WSN_repr_model_mtz>(factories, "REPR-mtz");
 
     // ####################### MAR Models #######################
-    (*model_runner).insert_model(WSN_arv_rot_model_mtz_base(instance, upper_bound), "MAR-mtz-base");
-    (*model_runner).insert_model(WSN_arv_rot_model_mtz(instance, upper_bound), "MAR-mtz");
-    (*model_runner).insert_model(WSN_arv_rot_model_flow_base(instance, upper_bound), "MAR-flow-base");
-    (*model_runner).insert_model(WSN_arv_rot_model_flow(instance, upper_bound), "MAR-flow");
+    register_model<WSN_arv_rot_model_mtz_base>(factories, "MAR-mtz-base");
+    register_model<WSN_arv_rot_model_mtz>(factories, "MAR-mtz");
+    register_model<WSN_arv_rot_model_flow_base>(factories, "MAR-flow-base");
+    register_model<WSN_arv_rot_model_flow>(factories, "MAR-flow");
+    register_model<WSN_arv_rot_model_lazy>(factories, "MAR-lazy");
+    register_model<WSN_arv_rot_model_lazy_cut>(factories, "MAR-lazy-cut");
+
+    // ##################### Decomposition ######################
+    register_model<WSN_benders>(factories, "Benders");
+    register_model<WSN_column_generation>(factories, "ColumnGeneration");
+
+    // ###################### Bounding Methods ######################
+    register_model<WSN_lagrangian>(factories, "Lagrangian");
+
+    return factories;
+}
+
+/**
+ * @brief Check that a model is registered, before anything is done with its name (e.g. the size estimate)
+ *
+ * @param model_name is the name of the model
+ * @throws std::invalid_argument with the registered names if the model does not exist
+ */
+void check_model_name(const std::string &model_name)
+{
+    static const auto factories = model_factories();
+
+    if (factories.find(model_name) != factories.end())
+    {
+        return;
+    }
+
+    std::ostringstream error_message;
+    error_message << "Model name do not exist in [";
+    for (auto it = factories.begin(); it != factories.end(); it++)
+    {
+        error_message << (it == factories.begin() ? "" : ", ") << it->first;
+    }
+    error_message << "]";
+
+    throw std::invalid_argument(error_message.str());
+}
+
+/**
+ * @brief Create a single model by name
+ *
+ * @param model_name is the registered name of the model
+ * @param instance is a problem instance
+ * @param upper_bound is an upper bound passed to the model
+ * @return std::unique_ptr<WSN> is the model, its env should be ended by the caller
+ */
+std::unique_ptr<WSN> create_model(std::string model_name, WSN_data &instance,
+                                  double upper_bound = std::numeric_limits<double>::max())
+{
+    static const auto factories = model_factories();
+
+    check_model_name(model_name);
+
+    return factories.at(model_name)(instance, upper_bound);
+}
+
+/**
+ * @brief Create a model runner and initialize with all models
+ *
+ * @param instance is a problem instances
+ * @return std::unique_ptr<ModelRunner<WSN>> is a pointer to the model runner
+ */
+std::unique_ptr<ModelRunner<WSN>> initialize_all_models(WSN_data &instance, double upper_bound = std::numeric_limits<double>::max())
+{
+    std::unique_ptr<ModelRunner<WSN>> model_runner = std::make_unique<ModelRunner<WSN>>();
+
+    for (auto &[name, factory] : model_factories())
+    {
+        (*model_runner).insert_model(factory(instance, upper_bound), name);
+    }
 
     return model_runner;
 }
\ No newline at end of file
@@ -9,6 +9,9 @@
 
 #include <regex>
 
+#include "util_solver_params.h"
+#include "util_symmetry.h"
+
 /**
  * @brief Structure with necessary parameters from input
  *
@@ -22,6 +25,22 @@ struct Run_Params
     bool relaxed = false;
     double upper_bound = -1.0;
     std::vector<std::string> constraints = {};
+    bool sweep = false;
+    std::string summary_path = "results.csv";
+    bool preprocess = false;
+    bool decompose = false;
+    bool lower_bounds = false;
+    std::string run_id = "";
+    std::string batch_path = "";
+    int workers = 1;
+    SolverParams solver;
+    double memory_budget = 0;
+    std::string fallback_model = "";
+    bool fast_relaxed = false;
+    bool export_root_lp = false;
+    bool reduced_cost_fixing = false;
+    symmetry::Ordering symmetry = symmetry::Ordering::Formulation;
+    bool symmetry_branching = false;
 
     friend std::ostream &operator<<(std::ostream &os, const Run_Params &o)
     {
@@ -43,6 +62,54 @@ struct Run_Params
             }
             os << o.constraints.back() << std::endl;
         }
+        os << "sweep: " << (o.sweep ? "yes" : "no") << std::endl;
+        os << "summary: " << o.summary_path << std::endl;
+        os << "preprocess: " << (o.preprocess ? "yes" : "no") << std::endl;
+        os << "decompose: " << (o.decompose ? "yes" : "no") << std::endl;
+        os << "lower bounds: " << (o.lower_bounds ? "yes" : "no") << std::endl;
+        if (!o.run_id.empty())
+        {
+            os << "run id: " << o.run_id << std::endl;
+        }
+        if (!o.batch_path.empty())
+        {
+            os << "batch: " << o.batch_path << " (workers: " << o.workers << ")" << std::endl;
+        }
+        os << "time limit: " << o.solver.time_limit << std::endl;
+        os << "threads: " << o.solver.threads << std::endl;
+        os << "parallel mode: " << o.solver.parallel_mode << std::endl;
+        if (o.solver.work_memory > 0)
+        {
+            os << "work memory: " << o.solver.work_memory << " MB" << std::endl;
+        }
+        if (o.solver.node_file >= 0)
+        {
+            os << "node file: " << o.solver.node_file << std::endl;
+        }
+        if (!o.solver.work_dir.empty())
+        {
+            os << "work dir: " << o.solver.work_dir << std::endl;
+        }
+        if (o.memory_budget > 0)
+        {
+            os << "memory budget: " << o.memory_budget << " MB" << std::endl;
+        }
+        if (!o.fallback_model.empty())
+        {
+            os << "fallback model: " << o.fallback_model << std::endl;
+        }
+        if (o.solver.lp_method != 0)
+        {
+            os << "lp method: " << o.solver.lp_method << std::endl;
+        }
+        if (o.solver.crossover != 0)
+        {
+            os << "crossover: " << o.solver.crossover << std::endl;
+        }
+        os << "fast relaxed: " << (o.fast_relaxed ? "yes" : "no") << std::endl;
+        os << "export root lp: " << (o.export_root_lp ? "yes" : "no") << std::endl;
+        os << "reduced cost fixing: " << (o.reduced_cost_fixing ? "yes" : "no") << std::endl;
+        os << "symmetry: " << symmetry::ordering_name(o.symmetry) << (o.symmetry_branching ? " (branching)" : "") << std::endl;
 
         return os;
     };
@@ -72,6 +139,30 @@ void PrintHelp()
                  "-m, --model [model_name]:       choosen model\n"
                  "-c, --constraints [constr_list]:      list of constraints\n"
                  "-U, --upper-bound [value]:       Upper bound to be passed to model\n"
+                 "-S, --sweep:                Solve for every number of sinks from 1 to K reusing the model\n"
+                 "-o, --summary <path>:       Results table (csv, or json lines if ends with .jsonl)\n"
+                 "-P, --preprocess:           Reduce the instance before building the model\n"
+                 "-D, --decompose:            Solve each connected component and combine the results\n"
+                 "-L, --lower-bounds:         Bound T by combinatorial lower bounds, skip the solver if the heuristic reaches them\n"
+                 "-R, --run-id <id>:          Label of the run on the results table\n"
+                 "-B, --batch <path>:         Solve the jobs of a file (lines: model K [-r]) on the instance read once\n"
+                 "-W, --workers <n>:          Jobs of the batch solved at the same time\n"
+                 "-T, --time-limit <s>:       Time limit of each solve in seconds (default 600)\n"
+                 "-t, --threads <n>:          Threads of cplex (default 0, cplex decides)\n"
+                 "-p, --parallel <mode>:      auto | deterministic | opportunistic (default auto)\n"
+                 "-M, --work-mem <MB>:        Memory of the tree before node files are used\n"
+                 "-N, --node-file <mode>:     none | memory | disk | disk-compressed\n"
+                 "-w, --work-dir <path>:      Directory of the node files\n"
+                 "-G, --memory-budget <MB>:   Do not build models whose estimated memory exceeds the budget\n"
+                 "-F, --fallback <model>:     Model solved instead when the chosen one exceeds the budget\n"
+                 "-A, --lp-method <method>:   auto | primal | dual | network | barrier | sifting | concurrent\n"
+                 "-X, --no-crossover:         No crossover after the barrier\n"
+                 "-f, --fast-relaxed:         Root LP only: barrier without crossover (unless -A is given), no .relaxed.lp\n"
+                 "                            and no variable values on .relaxed.sol\n"
+                 "-e, --export-root-lp:       Write values, reduced costs and duals of the relaxation on .relaxed.rlp (binary)\n"
+                 "-C, --reduced-cost-fixing:  Fix variables by the reduced costs of the root relaxation and the heuristic solution\n"
+                 "-Y, --symmetry <order>:     Order of the trees: none | root | tree (default the one of the formulation)\n"
+                 "-b, --symmetry-branching:   Impose the order of the trees by branching instead of rows\n"
                  "-h, --help:                Show help\n";
     exit(1);
 }
@@ -85,7 +176,7 @@ void PrintHelp()
  */
 Run_Params read_arguments(int argc, char **argv)
 {
-    const char *const short_opts = "K:ri:m:s:c:U:h";
+    const char *const short_opts = "K:ri:m:s:c:U:So:PDLR:B:W:T:t:p:M:N:w:G:F:A:XfeCY:bh";
     const option long_opts[] = {
         {"instance", required_argument, nullptr, 'i'},
         {"num-sinks", optional_argument, nullptr, 'K'},
@@ -95,6 +186,29 @@ Run_Params read_arguments(int argc, char **argv)
         {"help", no_argument, nullptr, 'h'},
         {"constraints", optional_argument, nullptr, 'c'},
         {"upper-bound", optional_argument, nullptr, 'U'},
+        {"sweep", no_argument, nullptr, 'S'},
+        {"summary", required_argument, nullptr, 'o'},
+        {"preprocess", no_argument, nullptr, 'P'},
+        {"decompose", no_argument, nullptr, 'D'},
+        {"lower-bounds", no_argument, nullptr, 'L'},
+        {"run-id", required_argument, nullptr, 'R'},
+        {"batch", required_argument, nullptr, 'B'},
+        {"workers", required_argument, nullptr, 'W'},
+        {"time-limit", required_argument, nullptr, 'T'},
+        {"threads", required_argument, nullptr, 't'},
+        {"parallel", required_argument, nullptr, 'p'},
+        {"work-mem", required_argument, nullptr, 'M'},
+        {"node-file", required_argument, nullptr, 'N'},
+        {"work-dir", required_argument, nullptr, 'w'},
+        {"memory-budget", required_argument, nullptr, 'G'},
+        {"fallback", required_argument, nullptr, 'F'},
+        {"lp-method", required_argument, nullptr, 'A'},
+        {"no-crossover", no_argument, nullptr, 'X'},
+        {"fast-relaxed", no_argument, nullptr, 'f'},
+        {"export-root-lp", no_argument, nullptr, 'e'},
+        {"reduced-cost-fixing", no_argument, nullptr, 'C'},
+        {"symmetry", required_argument, nullptr, 'Y'},
+        {"symmetry-branching", no_argument, nullptr, 'b'},
         {nullptr, no_argument, nullptr, 0}};
 
     std::string instance_path;
@@ -104,6 +218,23 @@ Run_Params read_arguments(int argc, char **argv)
     bool relaxed = false;
     double upper_bound = -1.0;
     std::vector<std::string> constraints({});
+    bool sweep = false;
+    std::string summary_path = "results.csv";
+    bool preprocess = false;
+    bool decompose = false;
+    bool lower_bounds = false;
+    std::string run_id = "";
+    std::string batch_path = "";
+    int workers = 1;
+    SolverParams solver;
+    double memory_budget = 0;
+    std::string fallback_model = "";
+    bool fast_relaxed = false;
+    bool export_root_lp = false;
+    bool reduced_cost_fixing = false;
+    symmetry::Ordering symmetry = symmetry::Ordering::Formulation;
+    bool symmetry_branching = false;
+    bool lp_method_given = false;
 
     while (true)
     {
@@ -160,6 +291,76 @@ Run_Params read_arguments(int argc, char **argv)
         case 'U':
             upper_bound = (optarg == NULL) ? upper_bound : std::stod(optarg);
             break;
+        case 'S':
+            sweep = true;
+            break;
+        case 'o':
+            summary_path = std::string(optarg);
+            break;
+        case 'P':
+            preprocess = true;
+            break;
+        case 'D':
+            decompose = true;
+            break;
+        case 'L':
+            lower_bounds = true;
+            break;
+        case 'R':
+            run_id = std::string(optarg);
+            break;
+        case 'B':
+            batch_path = std::string(optarg);
+            break;
+        case 'W':
+            workers = std::stoi(optarg);
+            break;
+        case 'T':
+            solver.time_limit = std::stod(optarg);
+            break;
+        case 't':
+            solver.threads = std::stoi(optarg);
+            break;
+        case 'p':
+            solver.parallel_mode = solver_params::parallel_mode(optarg);
+            break;
+        case 'M':
+            solver.work_memory = std::stod(optarg);
+            break;
+        case 'N':
+            solver.node_file = solver_params::node_file(optarg);
+            break;
+        case 'w':
+            solver.work_dir = std::string(optarg);
+            break;
+        case 'G':
+            memory_budget = std::stod(optarg);
+            break;
+        case 'F':
+            fallback_model = std::string(optarg);
+            break;
+        case 'A':
+            solver.lp_method = solver_params::lp_method(optarg);
+            lp_method_given = true;
+            break;
+        case 'X':
+            solver.crossover = -1;
+            break;
+        case 'f':
+            fast_relaxed = true;
+            break;
+        case 'e':
+            export_root_lp = true;
+            break;
+        case 'C':
+            reduced_cost_fixing = true;
+            break;
+        case 'Y':
+            symmetry = symmetry::ordering(optarg);
+            break;
+        case 'b':
+            symmetry_branching = true;
+            break;
         case 'h': // -h or --help
         case '?': // Unrecognized option
         default:
@@ -168,5 +369,17 @@ Run_Params read_arguments(int argc, char **argv)
         }
     }
 
-    return {instance_path, model, number_sinks, seed, relaxed, upper_bound, constraints};
+    // the root LP mode solves the relaxation with the barrier and without the crossover (a basis is not needed)
+    if (fast_relaxed)
+    {
+        relaxed = true;
+
+        if (!lp_method_given)
+        {
+            solver.lp_method = solver_params::lp_method("barrier");
+            solver.crossover = -1;
+        }
+    }
+
+    return {instance_path, model, number_sinks, seed, relaxed, upper_bound, constraints, sweep, summary_path, preprocess, decompose, lower_bounds, run_id, batch_path, workers, solver, memory_budget, fallback_model, fast_relaxed, export_root_lp, reduced_cost_fixing, symmetry, symmetry_branching};
 }
\ No newline at end of file
@@ -0,0 +1,296 @@
+#pragma once
+
+#include <ilcplex/ilocplex.h>
+#include "mip_backend.h"
+
+namespace backend
+{
+    /**
+     * @brief Lazy rows of a CplexBackend, added on the candidate context of a generic callback
+     *
+     */
+    class LazyRowCallback : public IloCplex::Callback::Function
+    {
+    public:
+        LazyRowCallback(IloNumVarArray &variables, LazyRowGenerator &generator);
+
+        void invoke(const IloCplex::Callback::Context &context) override;
+
+    private:
+        IloNumVarArray &variables;
+        LazyRowGenerator &generator;
+    };
+
+    inline LazyRowCallback::LazyRowCallback(IloNumVarArray &variables, LazyRowGenerator &generator) : variables(variables),
+                                                                                               generator(generator)
+    {
+    }
+
+    inline void LazyRowCallback::invoke(const IloCplex::Callback::Context &context)
+    {
+        if (!context.inCandidate() || !context.isCandidatePoint())
+        {
+            return;
+        }
+
+        IloEnv env = context.getEnv();
+        IloNumArray point(env, variables.getSize());
+        context.getCandidatePoint(variables, point);
+
+        std::vector<double> values(variables.getSize());
+        for (int i = 0; i < variables.getSize(); i++)
+        {
+            values[i] = point[i];
+        }
+        point.end();
+
+        auto rows = generator(values);
+
+        if (rows.empty())
+        {
+            return;
+        }
+
+        IloRangeArray cuts(env);
+        IloExpr expr(env);
+
+        for (auto &row : rows)
+        {
+            for (auto &[variable, coefficient] : row.expr)
+            {
+                expr += coefficient * variables[variable];
+            }
+
+            cuts.add(IloRange(env, row.lb == -infinity ? -IloInfinity : row.lb, expr,
+                              row.ub == infinity ? IloInfinity : row.ub));
+
+            expr.end();
+            expr = IloExpr(env);
+        }
+
+        expr.end();
+
+        context.rejectCandidate(cuts);
+
+        cuts.endElements();
+        cuts.end();
+    }
+
+    /**
+     * @brief MipBackend on cplex (Concert)
+     *
+     */
+    class CplexBackend : public MipBackend
+    {
+    public:
+        CplexBackend();
+        ~CplexBackend();
+
+        std::string name() override;
+
+        int add_variable(double lb, double ub, VarType type, const std::string &name) override;
+        void add_row(const Row &row) override;
+        void set_objective(const LinearExpr &expr, Sense sense) override;
+        void set_lazy_rows(LazyRowGenerator generator) override;
+
+        Status solve(double time_limit, int threads) override;
+
+        double value(int variable) override;
+        double objective_value() override;
+        double best_bound() override;
+        long nodes() override;
+
+        int number_variables() override;
+        int number_rows() override;
+
+    private:
+        IloEnv env;
+        IloModel model;
+        IloNumVarArray variables;
+        IloObjective objective;
+        bool has_objective = false;
+        int rows = 0;
+
+        // called by the threads of cplex at the same time, so it should not change shared state
+        LazyRowGenerator generator;
+
+        // values of the last solve (the cplex object is released after the solve)
+        std::vector<double> values;
+        double objective_ = std::numeric_limits<double>::quiet_NaN();
+        double bound_ = std::numeric_limits<double>::quiet_NaN();
+        long nodes_ = 0;
+
+        IloExpr to_expr(const LinearExpr &expr);
+        static double to_cplex(double bound);
+    };
+
+    inline CplexBackend::CplexBackend() : model(IloModel(env)), variables(IloNumVarArray(env))
+    {
+    }
+
+    inline CplexBackend::~CplexBackend()
+    {
+        env.end();
+    }
+
+    inline std::string CplexBackend::name()
+    {
+        return "Cplex";
+    }
+
+    inline double CplexBackend::to_cplex(double bound)
+    {
+        if (bound == infinity)
+        {
+            return IloInfinity;
+        }
+
+        return (bound == -infinity) ? -IloInfinity : bound;
+    }
+
+    inline IloExpr CplexBackend::to_expr(const LinearExpr &expr)
+    {
+        IloExpr result(env);
+
+        for (auto &[variable, coefficient] : expr)
+        {
+            result += coefficient * variables[variable];
+        }
+
+        return result;
+    }
+
+    inline int CplexBackend::add_variable(double lb, double ub, VarType type, const std::string &name)
+    {
+        IloNumVarType cplex_type = (type == VarType::Continuous) ? ILOFLOAT : ILOINT;
+
+        variables.add(IloNumVar(env, to_cplex(lb), to_cplex(ub), cplex_type, name.c_str()));
+
+        return variables.getSize() - 1;
+    }
+
+    inline void CplexBackend::add_row(const Row &row)
+    {
+        IloExpr expr = to_expr(row.expr);
+
+        model.add(IloRange(env, to_cplex(row.lb), expr, to_cplex(row.ub)));
+        rows++;
+
+        expr.end();
+    }
+
+    inline void CplexBackend::set_objective(const LinearExpr &expr, Sense sense)
+    {
+        IloExpr obj = to_expr(expr);
+
+        if (has_objective)
+        {
+            model.remove(objective);
+            objective.end();
+        }
+
+        objective = (sense == Sense::Minimize) ? IloMinimize(env, obj) : IloMaximize(env, obj);
+        model.add(objective);
+        has_objective = true;
+
+        obj.end();
+    }
+
+    inline void CplexBackend::set_lazy_rows(LazyRowGenerator _generator)
+    {
+        generator = _generator;
+    }
+
+    inline Status CplexBackend::solve(double time_limit, int threads)
+    {
+        // variables that are not on any row are still part of the model
+        model.add(variables);
+
+        IloCplex cplex(model);
+
+        cplex.setParam(IloCplex::Param::TimeLimit, time_limit);
+        cplex.setParam(IloCplex::Param::MIP::Tolerances::MIPGap, 1e-6);
+
+        if (threads > 0)
+        {
+            cplex.setParam(IloCplex::Param::Threads, threads);
+        }
+
+        LazyRowCallback callback(variables, generator);
+
+        if (generator)
+        {
+            cplex.use(&callback, IloCplex::Callback::Context::Id::Candidate);
+        }
+
+        cplex.solve();
+
+        auto status = cplex.getStatus();
+        bool has_solution = (status == IloAlgorithm::Optimal || status == IloAlgorithm::Feasible);
+
+        values.assign(variables.getSize(), std::numeric_limits<double>::quiet_NaN());
+
+        if (has_solution)
+        {
+            IloNumArray solution(env);
+            cplex.getValues(solution, variables);
+
+            for (int i = 0; i < variables.getSize(); i++)
+            {
+                values[i] = solution[i];
+            }
+
+            solution.end();
+            objective_ = cplex.getObjValue();
+        }
+
+        bound_ = (status == IloAlgorithm::Infeasible) ? std::numeric_limits<double>::quiet_NaN() : cplex.getBestObjValue();
+        nodes_ = cplex.getNnodes();
+
+        cplex.end();
+
+        switch (status)
+        {
+        case IloAlgorithm::Optimal:
+            return Status::Optimal;
+        case IloAlgorithm::Feasible:
+            return Status::Feasible;
+        case IloAlgorithm::Infeasible:
+            return Status::Infeasible;
+        case IloAlgorithm::Error:
+            return Status::Error;
+        default:
+            return Status::NoSolution;
+        }
+    }
+
+    inline double CplexBackend::value(int variable)
+    {
+        return values[variable];
+    }
+
+    inline double CplexBackend::objective_value()
+    {
+        return objective_;
+    }
+
+    inline double CplexBackend::best_bound()
+    {
+        return bound_;
+    }
+
+    inline long CplexBackend::nodes()
+    {
+        return nodes_;
+    }
+
+    inline int CplexBackend::number_variables()
+    {
+        return variables.getSize();
+    }
+
+    inline int CplexBackend::number_rows()
+    {
+        return rows;
+    }
+} // namespace backend
@@ -0,0 +1,256 @@
+#pragma once
+
+#include "Highs.h"
+#include <algorithm>
+#include "mip_backend.h"
+#include "util_results.h"
+
+namespace backend
+{
+    /**
+     * @brief MipBackend on HiGHS (open source, https://highs.dev), used where cplex is not installed.
+     *
+     * HiGHS has no lazy constraint callback, so the lazy rows are added by row generation: the mip
+     * is solved, the rows violated by its solution are added and the mip is solved again, until the
+     * solution is accepted. The bound of each solve is a bound of the full model (it has less rows),
+     * so a run stopped by the time limit still returns a valid bound.
+     */
+    class HighsBackend : public MipBackend
+    {
+    public:
+        HighsBackend();
+
+        std::string name() override;
+
+        int add_variable(double lb, double ub, VarType type, const std::string &name) override;
+        void add_row(const Row &row) override;
+        void set_objective(const LinearExpr &expr, Sense sense) override;
+        void set_lazy_rows(LazyRowGenerator generator) override;
+
+        Status solve(double time_limit, int threads) override;
+
+        double value(int variable) override;
+        double objective_value() override;
+        double best_bound() override;
+        long nodes() override;
+
+        int number_variables() override;
+        int number_rows() override;
+
+        int rounds = 0; // solves of the row generation
+
+    private:
+        Highs highs;
+        int variables = 0;
+        int rows = 0;
+
+        LazyRowGenerator generator;
+
+        std::vector<double> values;
+        double objective_ = std::numeric_limits<double>::quiet_NaN();
+        double bound_ = std::numeric_limits<double>::quiet_NaN();
+        long nodes_ = 0;
+
+        double to_highs(double bound);
+
+        // true if HiGHS could not load, presolve or solve the model
+        static bool failed(HighsModelStatus status);
+    };
+
+    inline HighsBackend::HighsBackend()
+    {
+        highs.setOptionValue("output_flag", false);
+        highs.setOptionValue("mip_rel_gap", 1e-6);
+    }
+
+    inline std::string HighsBackend::name()
+    {
+        return "Highs";
+    }
+
+    inline double HighsBackend::to_highs(double bound)
+    {
+        if (bound == infinity)
+        {
+            return highs.getInfinity();
+        }
+
+        return (bound == -infinity) ? -highs.getInfinity() : bound;
+    }
+
+    inline bool HighsBackend::failed(HighsModelStatus status)
+    {
+        switch (status)
+        {
+        case HighsModelStatus::kNotset:
+        case HighsModelStatus::kLoadError:
+        case HighsModelStatus::kModelError:
+        case HighsModelStatus::kPresolveError:
+        case HighsModelStatus::kSolveError:
+        case HighsModelStatus::kPostsolveError:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    inline int HighsBackend::add_variable(double lb, double ub, VarType type, const std::string &name)
+    {
+        if (type == VarType::Binary)
+        {
+            lb = std::max(lb, 0.0);
+            ub = std::min(ub, 1.0);
+        }
+
+        highs.addVar(to_highs(lb), to_highs(ub));
+
+        if (type != VarType::Continuous)
+        {
+            highs.changeColIntegrality(variables, HighsVarType::kInteger);
+        }
+
+        highs.passColName(variables, name);
+
+        return variables++;
+    }
+
+    inline void HighsBackend::add_row(const Row &row)
+    {
+        std::vector<HighsInt> index;
+        std::vector<double> coefficient;
+
+        for (auto &[variable, value] : row.expr)
+        {
+            index.push_back(variable);
+            coefficient.push_back(value);
+        }
+
+        highs.addRow(to_highs(row.lb), to_highs(row.ub), index.size(), index.data(), coefficient.data());
+        rows++;
+    }
+
+    inline void HighsBackend::set_objective(const LinearExpr &expr, Sense sense)
+    {
+        for (int i = 0; i < variables; i++)
+        {
+            highs.changeColCost(i, 0);
+        }
+
+        for (auto &[variable, coefficient] : expr)
+        {
+            highs.changeColCost(variable, coefficient);
+        }
+
+        highs.changeObjectiveSense(sense == Sense::Minimize ? ObjSense::kMinimize : ObjSense::kMaximize);
+    }
+
+    inline void HighsBackend::set_lazy_rows(LazyRowGenerator _generator)
+    {
+        generator = _generator;
+    }
+
+    inline Status HighsBackend::solve(double time_limit, int threads)
+    {
+        auto start = perf::time::start();
+
+        if (threads > 0)
+        {
+            highs.setOptionValue("threads", threads);
+        }
+
+        nodes_ = 0;
+        rounds = 0;
+
+        while (true)
+        {
+            double remaining = time_limit - perf::time::duration(start).count();
+
+            if (remaining <= 0)
+            {
+                return Status::NoSolution;
+            }
+
+            highs.setOptionValue("time_limit", remaining);
+
+            // a solve stopped by a limit (time, iterations, solutions or interrupt) returns a warning
+            if (highs.run() == HighsStatus::kError)
+            {
+                return Status::Error;
+            }
+
+            rounds++;
+
+            const HighsInfo &info = highs.getInfo();
+            auto model_status = highs.getModelStatus();
+
+            if (failed(model_status))
+            {
+                return Status::Error;
+            }
+
+            nodes_ += info.mip_node_count;
+            bound_ = info.mip_dual_bound;
+
+            if (model_status == HighsModelStatus::kInfeasible)
+            {
+                return Status::Infeasible;
+            }
+
+            if (info.primal_solution_status != kSolutionStatusFeasible)
+            {
+                return Status::NoSolution;
+            }
+
+            values = highs.getSolution().col_value;
+            objective_ = info.objective_function_value;
+
+            auto lazy_rows = generator ? generator(values) : std::vector<Row>();
+
+            if (lazy_rows.empty())
+            {
+                return (model_status == HighsModelStatus::kOptimal) ? Status::Optimal : Status::Feasible;
+            }
+
+            // the solution violates rows of the full model, it is not a solution
+            if (model_status != HighsModelStatus::kOptimal)
+            {
+                return Status::NoSolution;
+            }
+
+            for (auto &row : lazy_rows)
+            {
+                add_row(row);
+            }
+        }
+    }
+
+    inline double HighsBackend::value(int variable)
+    {
+        return values[variable];
+    }
+
+    inline double HighsBackend::objective_value()
+    {
+        return objective_;
+    }
+
+    inline double HighsBackend::best_bound()
+    {
+        return bound_;
+    }
+
+    inline long HighsBackend::nodes()
+    {
+        return nodes_;
+    }
+
+    inline int HighsBackend::number_variables()
+    {
+        return variables;
+    }
+
+    inline int HighsBackend::number_rows()
+    {
+        return rows;
+    }
+} // namespace backend
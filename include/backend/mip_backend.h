@@ -0,0 +1,107 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <utility>
+#include <functional>
+#include <limits>
+
+/**
+ * @brief Thin interface over a mip solver: variables, linear rows, a linear objective, lazy rows
+ * given on the integer solutions and the values of the solve. The models written on this
+ * interface do not include any solver header, so they are compiled with any of the backends
+ * (CplexBackend on cplex_backend.h, HighsBackend on highs_backend.h).
+ */
+namespace backend
+{
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    enum class VarType
+    {
+        Continuous,
+        Binary,
+        Integer
+    };
+
+    enum class Sense
+    {
+        Minimize,
+        Maximize
+    };
+
+    enum class Status
+    {
+        Optimal,    // optimal solution found
+        Feasible,   // solution found, the limits stopped the solve
+        Infeasible, // proved infeasible
+        NoSolution, // no solution found before the limits
+        Error
+    };
+
+    // sparse linear expression, pairs {variable, coefficient}
+    using LinearExpr = std::vector<std::pair<int, double>>;
+
+    // lb <= expr <= ub
+    struct Row
+    {
+        LinearExpr expr;
+        double lb = -infinity;
+        double ub = infinity;
+    };
+
+    // rows violated by an integer solution (values of all variables), empty if the solution is accepted
+    using LazyRowGenerator = std::function<std::vector<Row>(const std::vector<double> &)>;
+
+    /**
+     * @brief Name of a status, the same names written by cplex on the results
+     *
+     * @param status is the status of a solve
+     * @return std::string with its name
+     */
+    inline std::string status_name(Status status)
+    {
+        switch (status)
+        {
+        case Status::Optimal:
+            return "Optimal";
+        case Status::Feasible:
+            return "Feasible";
+        case Status::Infeasible:
+            return "Infeasible";
+        case Status::NoSolution:
+            return "Unknown";
+        default:
+            return "Error";
+        }
+    }
+
+    class MipBackend
+    {
+    public:
+        virtual ~MipBackend() = default;
+
+        // name of the solver, written on the name of the model
+        virtual std::string name() = 0;
+
+        // returns the index of the new variable
+        virtual int add_variable(double lb, double ub, VarType type, const std::string &name) = 0;
+
+        virtual void add_row(const Row &row) = 0;
+
+        virtual void set_objective(const LinearExpr &expr, Sense sense) = 0;
+
+        // called on every integer solution, the solution is rejected if rows are returned
+        virtual void set_lazy_rows(LazyRowGenerator generator) = 0;
+
+        // time_limit in seconds, threads = 0 lets the solver decide
+        virtual Status solve(double time_limit, int threads) = 0;
+
+        virtual double value(int variable) = 0;
+        virtual double objective_value() = 0;
+        virtual double best_bound() = 0;
+        virtual long nodes() = 0;
+
+        virtual int number_variables() = 0;
+        virtual int number_rows() = 0;
+    };
+} // namespace backend
@@ -0,0 +1,474 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <cmath>
+#include <limits>
+
+#include "mip_backend.h"
+#include "wsn_data.h"
+#include "wsn_solution.h"
+#include "util_benders.h"
+#include "util_results.h"
+#include "util_summary.h"
+
+/**
+ * @brief Benders formulation of WSN_benders (models/WSN_benders.h) written on the MipBackend
+ * interface, so it is solved by any of the backends: the roles (y, z), the arcs and the sink
+ * assignment on the model, and the connectivity and weight of the trees as lazy rows given by
+ * the subproblem of util_benders.h.
+ */
+class WSN_backend_model
+{
+public:
+    WSN_backend_model(WSN_data &instance, backend::MipBackend &solver);
+    WSN_backend_model(WSN_data &instance, backend::MipBackend &solver, double upper_bound);
+
+    // build the model, solve it and write the outputs and the summary of the run
+    void solve(double time_limit = 600, int threads = 0);
+
+    std::string name_model_instance();
+
+    std::string formulation_name;
+    std::string summary_path = "results.csv";
+    std::string run_id;
+    RunSummary last_run;
+    perf::PhaseRecorder phases; // time and memory of the phases of the run (parse is set by the caller)
+
+    // protected:
+    WSN_data &instance;
+    backend::MipBackend &solver;
+    double upper_bound;
+
+    std::vector<int> y;              // master
+    std::vector<int> z;              // bridge
+    std::vector<std::vector<int>> x; // arcs between nodes, -1 if the arc does not exist
+    std::vector<std::vector<int>> s; // arcs from the sinks, s[k][i]
+    int N;                           // number of bridge and master nodes
+    int T;                           // variable used on objective value
+
+    void build_model();
+    void add_decision_variables();
+
+    // the constraints of WSN::create_basic_model_constraints
+    void add_basic_model_constraints();
+
+    // each sink is connected to exactly one node
+    void add_sink_assignment_constraints();
+
+    // the arcs that leave a node are in the same tree (T >= weight of arcs out of a node)
+    void add_lower_bound_constraints();
+
+    void add_objective_function();
+
+    // feasibility and optimality cuts violated by an integer solution
+    std::vector<backend::Row> lazy_rows(const std::vector<double> &values);
+
+    backend::Row connectivity_cut(std::vector<int> &set, int v);
+    backend::Row optimality_cut(const benders::Tree &tree);
+
+    // arcs of a solution given by the values of the variables
+    ArcValues arc_values(const std::vector<double> &values);
+    std::vector<double> sink_values(const std::vector<double> &values);
+};
+
+inline WSN_backend_model::WSN_backend_model(WSN_data &instance, backend::MipBackend &solver) : instance(instance),
+                                                                                       solver(solver),
+                                                                                       upper_bound(std::numeric_limits<double>::max())
+{
+    formulation_name = "Benders" + solver.name();
+}
+
+inline WSN_backend_model::WSN_backend_model(WSN_data &instance, backend::MipBackend &solver, double upper_bound) : instance(instance),
+                                                                                                           solver(solver),
+                                                                                                           upper_bound(upper_bound)
+{
+    formulation_name = "Benders" + solver.name();
+}
+
+inline std::string WSN_backend_model::name_model_instance()
+{
+    return std::string(formulation_name + "_" + instance.name() + "_" + std::to_string(instance.n) + "_" + std::to_string(instance.number_trees));
+}
+
+inline void WSN_backend_model::build_model()
+{
+    add_decision_variables();
+
+    add_basic_model_constraints();
+    add_sink_assignment_constraints();
+    add_lower_bound_constraints();
+
+    add_objective_function();
+
+    solver.set_lazy_rows([this](const std::vector<double> &values)
+                         { return lazy_rows(values); });
+}
+
+inline void WSN_backend_model::add_decision_variables()
+{
+    using backend::VarType;
+
+    y.assign(instance.n, -1);
+    z.assign(instance.n, -1);
+    x.assign(instance.n, std::vector<int>(instance.n, -1));
+    s.assign(instance.number_trees, std::vector<int>(instance.n, -1));
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        z[i] = solver.add_variable(0, 1, VarType::Binary, "z(" + std::to_string(i) + ")");
+        y[i] = solver.add_variable(0, 1, VarType::Binary, "y(" + std::to_string(i) + ")");
+    }
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (auto &j : instance.adj_list_from_v[i])
+        {
+            x[i][j] = solver.add_variable(0, 1, VarType::Binary, "x(" + std::to_string(i) + ")(" + std::to_string(j) + ")");
+        }
+    }
+
+    for (int k = 0; k < instance.number_trees; k++)
+    {
+        for (int i = 0; i < instance.n; i++)
+        {
+            s[k][i] = solver.add_variable(0, 1, VarType::Binary, "x(" + std::to_string(instance.n + k) + ")(" + std::to_string(i) + ")");
+        }
+    }
+
+    N = solver.add_variable(0, backend::infinity, VarType::Continuous, "N");
+    T = solver.add_variable(0, backend::infinity, VarType::Continuous, "T");
+}
+
+inline void WSN_backend_model::add_basic_model_constraints()
+{
+    backend::Row row;
+
+    // Constraints 2: the number of masters and bridges is N
+    for (int i = 0; i < instance.n; i++)
+    {
+        row.expr.push_back({y[i], 1});
+        row.expr.push_back({z[i], 1});
+    }
+    row.expr.push_back({N, -1});
+    row.lb = row.ub = 0;
+    solver.add_row(row);
+
+    // Constraints 3: the number of edges of the forest is N - K
+    row = backend::Row();
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (auto &j : instance.adj_list_from_v[i])
+        {
+            row.expr.push_back({x[i][j], 1});
+        }
+    }
+    row.expr.push_back({N, -1});
+    row.lb = row.ub = -instance.number_trees;
+    solver.add_row(row);
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        // Constraints 4: a master or bridge has an incoming arc
+        row = backend::Row();
+        for (auto &from : instance.adj_list_to_v[i])
+        {
+            row.expr.push_back({x[from][i], 1});
+        }
+        for (int k = 0; k < instance.number_trees; k++)
+        {
+            row.expr.push_back({s[k][i], 1});
+        }
+        row.expr.push_back({y[i], -1});
+        row.expr.push_back({z[i], -1});
+        row.lb = row.ub = 0;
+        solver.add_row(row);
+
+        // Constraints 5: a node is a master or a bridge
+        solver.add_row({{{y[i], 1}, {z[i], 1}}, -backend::infinity, 1});
+
+        // Constraints 6: every node is a master or is neighbor of a master
+        row = backend::Row();
+        row.expr.push_back({y[i], 1});
+        for (auto &from : instance.adj_list_to_v[i])
+        {
+            row.expr.push_back({y[from], 1});
+        }
+        row.lb = 1;
+        solver.add_row(row);
+
+        for (auto &from : instance.adj_list_to_v[i])
+        {
+            // Constraints 7 and 8: adjacent nodes are not both masters, adjacent bridges are not connected
+            if (from > i)
+            {
+                solver.add_row({{{y[from], 1}, {y[i], 1}}, -backend::infinity, 1});
+
+                row = backend::Row();
+                row.expr = {{z[from], 1}, {z[i], 1}, {x[from][i], 1}};
+                if (x[i][from] >= 0)
+                {
+                    row.expr.push_back({x[i][from], 1});
+                }
+                row.ub = 2;
+                solver.add_row(row);
+            }
+
+            // Constraints 9: an arc joins a master and a bridge
+            solver.add_row({{{x[from][i], 2}, {z[from], -1}, {z[i], -1}, {y[from], -1}, {y[i], -1}}, -backend::infinity, 0});
+        }
+
+        // a trivial tree has just one master node
+        row = backend::Row();
+        row.expr.push_back({z[i], 2});
+        for (auto &to : instance.adj_list_from_v[i])
+        {
+            row.expr.push_back({x[i][to], -1});
+        }
+        for (auto &from : instance.adj_list_to_v[i])
+        {
+            row.expr.push_back({x[from][i], -1});
+        }
+        row.ub = 0;
+        solver.add_row(row);
+    }
+
+    // upper bound
+    if (upper_bound < std::numeric_limits<double>::max())
+    {
+        solver.add_row({{{T, 1}}, -backend::infinity, upper_bound});
+    }
+}
+
+inline void WSN_backend_model::add_sink_assignment_constraints()
+{
+    for (int k = 0; k < instance.number_trees; k++)
+    {
+        backend::Row row;
+
+        for (int i = 0; i < instance.n; i++)
+        {
+            row.expr.push_back({s[k][i], 1});
+        }
+        row.lb = row.ub = 1;
+
+        solver.add_row(row);
+    }
+}
+
+inline void WSN_backend_model::add_lower_bound_constraints()
+{
+    for (int i = 0; i < instance.n; i++)
+    {
+        backend::Row row;
+
+        row.expr.push_back({T, 1});
+        for (auto &to : instance.adj_list_from_v[i])
+        {
+            row.expr.push_back({x[i][to], -instance.weight[i][to]});
+        }
+        row.lb = 0;
+
+        solver.add_row(row);
+    }
+}
+
+inline void WSN_backend_model::add_objective_function()
+{
+    solver.set_objective({{T, 1}}, backend::Sense::Minimize);
+}
+
+inline ArcValues WSN_backend_model::arc_values(const std::vector<double> &values)
+{
+    ArcValues arc_value(instance);
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (int p = 0; p < arc_value.degree(i); p++)
+        {
+            arc_value.at(i, p) = values[x[i][arc_value.head(i, p)]];
+        }
+    }
+
+    return arc_value;
+}
+
+inline std::vector<double> WSN_backend_model::sink_values(const std::vector<double> &values)
+{
+    std::vector<double> sink_value(instance.n, 0.0);
+
+    for (int k = 0; k < instance.number_trees; k++)
+    {
+        for (int i = 0; i < instance.n; i++)
+        {
+            sink_value[i] += values[s[k][i]];
+        }
+    }
+
+    return sink_value;
+}
+
+inline std::vector<backend::Row> WSN_backend_model::lazy_rows(const std::vector<double> &values)
+{
+    auto subproblem = benders::solve_subproblem(instance, arc_values(values), sink_values(values));
+
+    std::vector<backend::Row> rows;
+
+    for (auto &subtour : subproblem.subtours)
+    {
+        rows.push_back(connectivity_cut(subtour, subtour.front()));
+    }
+
+    for (auto &tree : subproblem.trees)
+    {
+        if (tree.weight > values[T] + 1e-6)
+        {
+            rows.push_back(optimality_cut(tree));
+        }
+    }
+
+    return rows;
+}
+
+inline backend::Row WSN_backend_model::connectivity_cut(std::vector<int> &set, int v)
+{
+    std::vector<bool> in_set(instance.n, false);
+    for (auto &i : set)
+    {
+        in_set[i] = true;
+    }
+
+    // x(in(S)) >= y(v) + z(v)
+    backend::Row row;
+
+    for (auto &j : set)
+    {
+        for (auto &from : instance.adj_list_to_v[j])
+        {
+            if (!in_set[from])
+            {
+                row.expr.push_back({x[from][j], 1});
+            }
+        }
+
+        for (int k = 0; k < instance.number_trees; k++)
+        {
+            row.expr.push_back({s[k][j], 1});
+        }
+    }
+
+    row.expr.push_back({y[v], -1});
+    row.expr.push_back({z[v], -1});
+    row.lb = 0;
+
+    return row;
+}
+
+inline backend::Row WSN_backend_model::optimality_cut(const benders::Tree &tree)
+{
+    // T + sum c(a) (1 - x(a)) >= W
+    backend::Row row;
+    row.lb = tree.weight;
+
+    row.expr.push_back({T, 1});
+    for (size_t a = 0; a < tree.arcs.size(); a++)
+    {
+        auto [i, j] = tree.arcs[a];
+
+        row.expr.push_back({x[i][j], -tree.coefficient[a]});
+        row.lb -= tree.coefficient[a];
+    }
+
+    return row;
+}
+
+inline void WSN_backend_model::solve(double time_limit, int threads)
+{
+    auto _name_model_instance = name_model_instance();
+    std::string time_now = print::time_now();
+
+    // the rows are added to the solver while the model is built, so there is no extract phase
+    auto start = perf::time::start();
+    phases.start(perf::Phase::Build);
+    build_model();
+
+    RunSummary run;
+    run.build_time = perf::time::duration(start).count();
+
+    start = perf::time::start();
+    phases.start(perf::Phase::Solve);
+    auto status = solver.solve(time_limit, threads);
+    run.solve_time = perf::time::duration(start).count();
+
+    phases.start(perf::Phase::Output);
+
+    std::ofstream solution((_name_model_instance + ".sol").c_str());
+    std::ofstream cout((_name_model_instance + ".out").c_str());
+
+    cout << time_now << std::endl;
+    solution << time_now << std::endl;
+
+    run.status = backend::status_name(status);
+    run.best_bound = solver.best_bound();
+    run.nodes = solver.nodes();
+    run.rows = solver.number_rows();
+    run.cols = solver.number_variables();
+
+    if (status == backend::Status::Optimal || status == backend::Status::Feasible)
+    {
+        run.objective = solver.objective_value();
+        run.gap = std::abs(run.objective - run.best_bound) / (1e-10 + std::abs(run.objective));
+
+        std::vector<std::vector<int>> edges;
+        std::vector<int> masters, bridges;
+
+        for (int i = 0; i < instance.n; i++)
+        {
+            for (auto &j : instance.adj_list_from_v[i])
+            {
+                if (solver.value(x[i][j]) > 0.5)
+                {
+                    edges.push_back({i, j});
+                }
+            }
+
+            if (solver.value(y[i]) > 0.5)
+            {
+                masters.push_back(i);
+            }
+
+            if (solver.value(z[i]) > 0.5)
+            {
+                bridges.push_back(i);
+            }
+        }
+
+        print_solution(edges, masters, bridges, 1, solution);
+
+        WSN_solution solution_checker(instance);
+        bool solution_valid = solution_checker.is_valid(edges, masters, bridges);
+
+        cout << "Solution is" << (solution_valid ? "" : " not") << " valid" << std::endl;
+
+        run.valid = solution_valid ? 1 : 0;
+    }
+
+    cout << "time: " << run.solve_time << std::endl;
+    cout << "obj: " << run.objective << std::endl;
+    cout << "best_obj: " << run.best_bound << std::endl;
+    cout << "gap: " << (run.gap * 100) << " %" << std::endl;
+    cout << "status: " << run.status << std::endl;
+
+    run.time_now = print::time_now();
+    run.instance = instance.name();
+    run.n = instance.n;
+    run.model = formulation_name;
+    run.number_trees = instance.number_trees;
+    run.run_id = run_id;
+    summary::add_resources(run, phases);
+
+    last_run = run;
+    summary::append(summary_path, run);
+}
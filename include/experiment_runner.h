@@ -0,0 +1,438 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <set>
+#include <sstream>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <stdexcept>
+#include <cctype>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+
+/**
+ * @brief Experiments described by a manifest, one line per group of runs of all_models:
+ *
+ *     # model          instances     K      options of all_models
+ *     MCFModel         instances/    1-8    -r
+ *     FlowModel3-base  instances/    8      -r --sweep
+ *
+ * The instances are a file or a directory (every file of it) and K is a number, a range
+ * (1-8) or a list (1,2,4). Each run is identified on the results table by its run id, and is
+ * done once its id is on the table of completed runs (see completed_table).
+ */
+namespace experiment
+{
+    struct Run
+    {
+        std::string model;
+        std::string instance_path;
+        int number_trees;
+        std::vector<std::string> options; // extra options passed to all_models
+        std::string id;
+    };
+
+    /**
+     * @brief Name of an instance as written on the results table (see WSN_data::name)
+     *
+     * @param instance_path is the path of the instance file
+     * @return std::string
+     */
+    inline std::string instance_name(const std::string &instance_path)
+    {
+        auto name = std::filesystem::path(instance_path).filename().stem().string();
+        std::replace(name.begin(), name.end(), '_', '-');
+
+        return name;
+    }
+
+    /**
+     * @brief Identifier of a run, the same run on any machine or directory has the same id
+     *
+     * @param model is the registered name of the model
+     * @param instance_path is the path of the instance
+     * @param number_trees is K
+     * @param options are the extra options of all_models
+     * @return std::string model|instance|K|options
+     */
+    inline std::string run_id(const std::string &model, const std::string &instance_path, int number_trees,
+                       const std::vector<std::string> &options)
+    {
+        std::string id = model + "|" + instance_name(instance_path) + "|" + std::to_string(number_trees) + "|";
+
+        for (int i = 0; i < (int)options.size(); i++)
+        {
+            id += (i > 0 ? " " : "") + options[i];
+        }
+
+        return id;
+    }
+
+    /**
+     * @brief Name of the directory where the output files of a run are written
+     *
+     * @param id is the run id
+     * @return std::string with the characters other than letters, digits, '-' and '.' replaced by '_'
+     */
+    inline std::string directory_name(const std::string &id)
+    {
+        std::string name = id;
+
+        for (auto &c : name)
+        {
+            if (!std::isalnum((unsigned char)c) && c != '-' && c != '.')
+            {
+                c = '_';
+            }
+        }
+
+        return name;
+    }
+
+    /**
+     * @brief Parse the numbers of trees of a manifest line
+     *
+     * @param spec is a number (3), a range (1-8) or a list (1,2,4)
+     * @return std::vector<int> with the numbers of trees in the given order
+     */
+    inline std::vector<int> parse_trees(const std::string &spec)
+    {
+        std::vector<int> trees;
+        std::stringstream list(spec);
+        std::string item;
+
+        while (std::getline(list, item, ','))
+        {
+            auto dash = item.find('-');
+
+            int first = std::stoi(item.substr(0, dash));
+            int last = (dash == std::string::npos) ? first : std::stoi(item.substr(dash + 1));
+
+            if (first < 1 || last < first)
+            {
+                throw std::invalid_argument("Invalid number of trees: " + spec);
+            }
+
+            for (int k = first; k <= last; k++)
+            {
+                trees.push_back(k);
+            }
+        }
+
+        return trees;
+    }
+
+    /**
+     * @brief Instances of a manifest line
+     *
+     * @param path is an instance file or a directory
+     * @return std::vector<std::string> with the path or the files of the directory sorted by name
+     */
+    inline std::vector<std::string> instance_files(const std::string &path)
+    {
+        if (!std::filesystem::is_directory(path))
+        {
+            if (!std::filesystem::is_regular_file(path))
+            {
+                throw std::invalid_argument("Instance not found: " + path);
+            }
+
+            return {path};
+        }
+
+        std::vector<std::string> files;
+
+        for (auto &entry : std::filesystem::directory_iterator(path))
+        {
+            if (entry.is_regular_file())
+            {
+                files.push_back(entry.path().string());
+            }
+        }
+
+        std::sort(files.begin(), files.end());
+
+        return files;
+    }
+
+    /**
+     * @brief Read the runs of a manifest, in the order of run_tests.sh (line, instance, K).
+     * Relative instance paths are relative to the directory where the runner is called.
+     *
+     * @param manifest is the manifest stream
+     * @return std::vector<Run> with every run of the manifest
+     */
+    inline std::vector<Run> read_manifest(std::istream &manifest)
+    {
+        std::vector<Run> runs;
+        std::string line;
+        int line_number = 0;
+
+        while (std::getline(manifest, line))
+        {
+            line_number++;
+            line = line.substr(0, line.find('#'));
+
+            std::stringstream words(line);
+            std::string model, instances, trees, option;
+            std::vector<std::string> options;
+
+            if (!(words >> model))
+            {
+                continue;
+            }
+
+            if (!(words >> instances >> trees))
+            {
+                throw std::invalid_argument("Line " + std::to_string(line_number) + " of the manifest must have a model, the instances and K");
+            }
+
+            while (words >> option)
+            {
+                options.push_back(option);
+            }
+
+            for (auto &instance_path : instance_files(instances))
+            {
+                for (int k : parse_trees(trees))
+                {
+                    runs.push_back({model, instance_path, k, options, run_id(model, instance_path, k, options)});
+                }
+            }
+        }
+
+        return runs;
+    }
+
+    inline std::vector<Run> read_manifest(const std::string &path)
+    {
+        std::ifstream manifest(path.c_str());
+
+        if (!manifest)
+        {
+            throw std::invalid_argument("Could not open the manifest " + path);
+        }
+
+        return read_manifest(manifest);
+    }
+
+    /**
+     * @brief Runs of the manifest that were not completed (each run only once)
+     *
+     * @param runs are the runs of the manifest
+     * @param done are the run ids of the completed runs
+     * @return std::vector<Run>
+     */
+    inline std::vector<Run> pending_runs(const std::vector<Run> &runs, const std::set<std::string> &done)
+    {
+        std::vector<Run> pending;
+        std::set<std::string> scheduled;
+
+        for (auto &run : runs)
+        {
+            if (done.count(run.id) == 0 && scheduled.insert(run.id).second)
+            {
+                pending.push_back(run);
+            }
+        }
+
+        return pending;
+    }
+
+    /**
+     * @brief Table of the completed runs of a results table, one run id per line. A run writes
+     * its rows while it is solved (one per K of a sweep, one per component of a decomposition),
+     * so it is only recorded as completed by the runner, after its process exits with status 0.
+     *
+     * @param summary_path is the results table
+     * @return std::string with the path of the table of completed runs (results.csv.done)
+     */
+    inline std::string completed_table(const std::string &summary_path)
+    {
+        return summary_path + ".done";
+    }
+
+    /**
+     * @brief Read the completed runs
+     *
+     * @param path is the table of completed runs (a missing table has no runs)
+     * @return std::set<std::string> with the run ids
+     */
+    inline std::set<std::string> read_completed(const std::string &path)
+    {
+        std::ifstream in(path.c_str());
+        std::set<std::string> ids;
+        std::string line;
+
+        while (std::getline(in, line))
+        {
+            if (!line.empty())
+            {
+                ids.insert(line);
+            }
+        }
+
+        return ids;
+    }
+
+    /**
+     * @brief Append a run to the table of completed runs (locked, so runners can share it)
+     *
+     * @param path is the table of completed runs
+     * @param id is the run id
+     */
+    inline void mark_completed(const std::string &path, const std::string &id)
+    {
+        int fd = open(path.c_str(), O_WRONLY | O_APPEND | O_CREAT, 0644);
+
+        if (fd < 0)
+        {
+            throw std::runtime_error("Could not open the table of completed runs " + path);
+        }
+
+        std::string line = id + "\n";
+
+        flock(fd, LOCK_EX);
+        auto written = write(fd, line.c_str(), line.size());
+        flock(fd, LOCK_UN);
+        close(fd);
+
+        if (written != (ssize_t)line.size())
+        {
+            throw std::runtime_error("Could not write on the table of completed runs " + path);
+        }
+    }
+
+    /**
+     * @brief Cores of a worker slot, consecutive blocks of threads cores (wrapping around the
+     * cores of the machine), so slots do not share cores while slots * threads <= cores
+     *
+     * @param slot is the index of the slot
+     * @param threads is the number of threads of each run
+     * @param cores is the number of cores of the machine
+     * @return std::vector<int>
+     */
+    inline std::vector<int> slot_cores(int slot, int threads, int cores)
+    {
+        std::vector<int> slot_cores;
+
+        for (int t = 0; t < std::min(threads, cores); t++)
+        {
+            slot_cores.push_back((slot * threads + t) % cores);
+        }
+
+        return slot_cores;
+    }
+
+    /**
+     * @brief Arguments of all_models for a run
+     *
+     * @param run is the run
+     * @param summary_path is the results table
+     * @param threads is the number of threads of cplex (0 does not pass it, cplex uses the cores of the run)
+     * @param memory_budget is the memory budget of the model in MB (0 does not pass it)
+     * @return std::vector<std::string> without the name of the program
+     */
+    inline std::vector<std::string> run_arguments(const Run &run, const std::string &summary_path, int threads = 0,
+                                           long memory_budget = 0)
+    {
+        std::vector<std::string> arguments = {"-i", run.instance_path, "-m", run.model,
+                                              "-K", std::to_string(run.number_trees),
+                                              "-o", summary_path, "-R", run.id};
+
+        if (threads > 0)
+        {
+            arguments.insert(arguments.end(), {"-t", std::to_string(threads)});
+        }
+
+        if (memory_budget > 0)
+        {
+            arguments.insert(arguments.end(), {"-G", std::to_string(memory_budget)});
+        }
+
+        arguments.insert(arguments.end(), run.options.begin(), run.options.end());
+
+        return arguments;
+    }
+
+    /**
+     * @brief Solve of a model inside a batch on an instance loaded once (see WSN_batch)
+     *
+     */
+    struct Job
+    {
+        std::string model;
+        int number_trees;
+        bool relaxed = false;
+    };
+
+    /**
+     * @brief Read the jobs of a batch, one line per model: the model, K (as on a manifest) and
+     * optionally -r (or --relaxed) to solve the relaxation
+     *
+     *     MCFModel   1-8  -r
+     *     MTZ-sbpo   2
+     *
+     * @param jobs is the stream with the jobs
+     * @return std::vector<Job> in the order of the lines and of K
+     */
+    inline std::vector<Job> read_jobs(std::istream &jobs)
+    {
+        std::vector<Job> list;
+        std::string line;
+        int line_number = 0;
+
+        while (std::getline(jobs, line))
+        {
+            line_number++;
+            line = line.substr(0, line.find('#'));
+
+            std::stringstream words(line);
+            std::string model, trees, option;
+            bool relaxed = false;
+
+            if (!(words >> model))
+            {
+                continue;
+            }
+
+            if (!(words >> trees))
+            {
+                throw std::invalid_argument("Line " + std::to_string(line_number) + " of the batch must have a model and K");
+            }
+
+            while (words >> option)
+            {
+                if (option != "-r" && option != "--relaxed")
+                {
+                    throw std::invalid_argument("Line " + std::to_string(line_number) + " of the batch has an unknown option " + option);
+                }
+
+                relaxed = true;
+            }
+
+            for (int k : parse_trees(trees))
+            {
+                list.push_back({model, k, relaxed});
+            }
+        }
+
+        return list;
+    }
+
+    inline std::vector<Job> read_jobs(const std::string &path)
+    {
+        std::ifstream jobs(path.c_str());
+
+        if (!jobs)
+        {
+            throw std::invalid_argument("Could not open the batch " + path);
+        }
+
+        return read_jobs(jobs);
+    }
+} // namespace experiment
@@ -26,13 +26,6 @@ private:
      */
     bool is_model_valid(std::string model_name) { return (map_models.find(model_name) != map_models.end()); };
 
-    /**
-     * @brief Return a list of the registered models
-     *
-     * @return std::vector<std::string> list of the registered models
-     */
-    std::vector<std::string> list_of_models();
-
     /**
      * @brief Return a string with all model names separated by commas
      *
@@ -44,6 +37,13 @@ public:
     ModelRunner() {}
     ~ModelRunner(){};
 
+    /**
+     * @brief Return a list of the registered models
+     *
+     * @return std::vector<std::string> list of the registered models
+     */
+    std::vector<std::string> list_of_models();
+
     /**
      * @brief Insert a model to runner
      *
@@ -54,6 +54,22 @@ public:
     template <class T>
     void insert_model(T new_model, std::string name);
 
+    /**
+     * @brief Insert a model created elsewhere (e.g. by a factory) to runner
+     *
+     * @param new_model is the new model to be registered
+     * @param name is the name that will be associated with the model
+     */
+    void insert_model(std::unique_ptr<Base> new_model, std::string name);
+
+    /**
+     * @brief Return a registered model by name
+     *
+     * @param model_name is the name of the model
+     * @return Base& is the registered model
+     */
+    Base &get_model(std::string model_name);
+
     /**
      * @brief Runs a model by name
      *
@@ -61,6 +77,15 @@ public:
      * @param relaxed defines if it will solve the full or relaxed model
      */
     void run_model(std::string model_name, bool relaxed);
+
+    /**
+     * @brief Runs a model by name for every number of trees up to the one of the instance,
+     * building the model only once
+     *
+     * @param model_name is the name of model that you can run
+     * @param relaxed defines if it will solve the full or relaxed model
+     */
+    void run_sweep(std::string model_name, bool relaxed);
 };
 
 template <class Base>
@@ -98,19 +123,29 @@ inline std::string ModelRunner<Base>::name_of_models()
 }
 
 template <class Base>
-inline void ModelRunner<Base>::run_model(std::string model_name, bool relaxed)
+inline Base &ModelRunner<Base>::get_model(std::string model_name)
 {
-    if (is_model_valid(model_name))
-    {
-        (*map_models[model_name]).solve(relaxed);
-    }
-    else
+    if (!is_model_valid(model_name))
     {
         std::ostringstream error_message;
         error_message << "Model name do not exist in [" << name_of_models() << "]";
 
         throw std::invalid_argument(error_message.str());
     }
+
+    return *map_models[model_name];
+}
+
+template <class Base>
+inline void ModelRunner<Base>::run_model(std::string model_name, bool relaxed)
+{
+    get_model(model_name).solve(relaxed);
+}
+
+template <class Base>
+inline void ModelRunner<Base>::run_sweep(std::string model_name, bool relaxed)
+{
+    get_model(model_name).solve_sweep(relaxed);
 }
 
 template <class Base>
@@ -125,4 +160,17 @@ inline void ModelRunner<Base>::insert_model(T new_model, std::string name)
     {
         throw std::invalid_argument("Registering a new model with an existing name.");
     }
-}
\ No newline at end of file
+}
+
+template <class Base>
+inline void ModelRunner<Base>::insert_model(std::unique_ptr<Base> new_model, std::string name)
+{
+    if (!is_model_valid(name))
+    {
+        map_models[name] = std::move(new_model);
+    }
+    else
+    {
+        throw std::invalid_argument("Registering a new model with an existing name.");
+    }
+}
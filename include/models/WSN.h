@@ -7,6 +7,19 @@
 #include <iostream>
 #include "wsn_solution.h"
 #include "util_model.h"
+#include "util_progress.h"
+#include "util_callback.h"
+#include "util_summary.h"
+#include "util_solver_params.h"
+#include "util_root_lp.h"
+#include "util_symmetry_branching.h"
+#include "wsn_preprocessing.h"
+#include "util_lower_bounds.h"
+#include "wsn_constructive_heur.h"
+#include "util_graph.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
 
 /**
  * @brief Class that defines a common part of implementation of a mip model for WSN problem
@@ -17,7 +30,10 @@ class WSN
 public:
     WSN(WSN_data &instance, std::string formulation_name, double upper_bound);
     WSN(WSN_data &instance, std::string formulation_name);
-    void solve(bool solve_relaxed = false);
+    virtual void solve(bool solve_relaxed = false);
+
+    // build the model once for instance.number_trees and solve it for K = 1, ..., instance.number_trees
+    void solve_sweep(bool solve_relaxed = false);
     std::string name_model_instance();
 
     // protected:
@@ -39,6 +55,33 @@ public:
 
     double upper_bound; // upper bound
 
+    IloRange forest_edges_constraint; // number of edges of the forest (depends on the number of trees)
+
+    std::string summary_path = "results.csv"; // results table where the summary of each run is appended
+    std::string run_id;                       // label of the runs on the results table (see RunSummary)
+    WSN_reduction *reduction = nullptr;       // reductions of the original instance (instance is the reduced one)
+    SolverParams solver_params;               // time limit, threads and memory of cplex
+    RunSummary last_run;                      // summary of the last solve
+    double build_time = 0;                    // time spent on build_model
+    bool use_lower_bounds = false;            // bound T by the combinatorial lower bounds before solving
+    perf::PhaseRecorder phases;               // time and memory of the phases of the run (parse and preprocess are set by the caller)
+    bool fast_relaxed = false;                // relaxation without the .relaxed.lp export and the values on .relaxed.sol
+    bool export_root_lp = false;              // write the values, reduced costs and duals of the relaxation on .relaxed.rlp
+    bool reduced_cost_fixing = false;         // fix variables by the reduced costs of the root relaxation before the mip
+    long fixed_variables = 0;                 // variables fixed by the reduced costs on the last solve
+
+    // variables indexed by sink (or by representative) of the formulation, see set_per_sink_variables
+    IloArray<IloArray<IloNumVarArray>> sink_arcs; // sink_arcs[k][i][j] on the arcs of the instance and on the arcs of the sink
+    IloArray<IloNumVarArray> sink_masters;        // sink_masters[k][v], used when per_sink_nodes
+    IloArray<IloNumVarArray> sink_bridges;        // sink_bridges[k][v], used when per_sink_nodes
+    bool per_sink_nodes = false;                  // the formulation has masters and bridges indexed by sink
+    std::vector<int> sink_row;                    // row of sink_arcs[k] with the arcs of the sink, -1 if it has none
+    std::vector<int> sink_first_node;             // first node with variables of the index k
+
+    symmetry::Ordering symmetry = symmetry::Ordering::Formulation; // order of the interchangeable trees
+    bool symmetry_branching = false;                               // impose the order by branching instead of rows
+    SymmetryBrancher symmetry_brancher;                            // active when the order is imposed by branching
+
     virtual void add_objective_function() = 0;
     void add_decision_variables();
 
@@ -71,26 +114,97 @@ public:
     // a trivial tree should have just one master node
     void add_trivial_tree_constraints();
 
+    // inequalities 3.1, 3.5, 3.6 and 4.3 of Bektas2014 on the labels pi of the nodes (n is the largest label),
+    // only on the triples (i, j, k) where the arcs (i, j), (j, k) and (i, k) exist
+    void add_bektas2014_inequalities(IloNumVarArray &pi, int n);
+
     // create decision variables and add basic model constraints
     void create_basic_model_constraints();
 
     // add a upper bound to the model
     void add_upper_bound_constraint();
 
+    // fix the variables given by the preprocessing of the instance
+    void add_reduction_fixings();
+
+    // set the combinatorial lower bound on T, returns true if the heuristic solution closes the run
+    bool close_by_bounds(std::string &name_model_instance, std::string time_now, bool relaxed);
+
+    // write the outputs and the summary of a run solved without cplex (run has the values of the solve)
+    void write_results_without_solver(std::string &name_model_instance, std::string time_now, RunSummary &run,
+                                      SolutionHeuristic *sol);
+
     // returns a copy of actual model with a relaxation of the integer variables
     virtual IloModel create_relaxed();
 
     virtual void create_start_solution(IloCplex &cplex);
     virtual void set_params_cplex(IloCplex &cplex);
 
+    // set the time limit, threads, parallel mode and memory of solver_params (also used by the relaxations)
+    void set_solver_params(IloCplex &cplex);
+
+    // register the callbacks used by the formulation (e.g. lazy constraints) on the mip solve
+    virtual void add_callbacks(CallbackDispatcher &callbacks);
+
     // relax the created model, solve and print all necessary outputs
     virtual void solve_relaxed(std::string &name_model_instance, std::string time_now);
 
     // solve and print all necessary outputs of model
     virtual void solve_mip(std::string &name_model_instance, std::string time_now);
 
+    // append the summary of a solved model to the results table
+    void write_summary(IloCplex &cplex, double elapsed, bool relaxed, int valid);
+
+    // values, reduced costs and duals of a solved relaxation (the duals of the rows of constraints, NaN for
+    // the constraints that are not linear ranges)
+    root_lp::Solution root_lp_solution(IloCplex &cplex);
+
+    // add the arcs of the instance and the arcs of the sinks to arcs, with their ends
+    void add_arc_variables(IloNumVarArray &arcs, std::vector<int> &from, std::vector<int> &to);
+
+    // register the arcs indexed by sink k of the formulation, with the arcs of the sink k on the row sink_row[k]
+    // of arcs (-1 if none) and the variables of k on the nodes v >= first_node[k] (0 when first_node is empty)
+    void set_per_sink_variables(IloArray<IloArray<IloNumVarArray>> &arcs, std::vector<int> sink_row, std::vector<int> first_node = {});
+
+    // register the arcs, masters and bridges indexed by sink of the formulation (see above)
+    void set_per_sink_variables(IloArray<IloArray<IloNumVarArray>> &arcs, IloArray<IloNumVarArray> &masters, IloArray<IloNumVarArray> &bridges,
+                                std::vector<int> sink_row, std::vector<int> first_node = {});
+
+    // add the registered variables indexed by sink (fixed by reduced costs with x, y and z)
+    void add_per_sink_variables(IloNumVarArray &variables);
+
+    // solve the root relaxation and fix the variables whose reduced cost exceeds the gap to the heuristic solution
+    void fix_by_reduced_costs();
+
+    // keys e[k][v] of an order of the trees (see symmetry namespace), on the registered variables indexed by the
+    // trees, or the root order on the arcs of the sinks
+    IloArray<IloExprArray> symmetry_keys(symmetry::Ordering ordering);
+
+    // add the rows of the order of the trees chosen by symmetry, or set the keys of the brancher when symmetry_branching
+    // (the rows of the formulation, as test_5, are kept when symmetry is Formulation)
+    void add_symmetry_breaking();
+
+    // print the values of a solved relaxation
+    void print_relaxed_results(IloCplex &cplex, double elapsed, std::ostream &relaxed_out, std::ostream &relaxed_sol);
+
+    // print the values of a solved mip and check the solution
+    void print_mip_results(IloCplex &cplex, double elapsed, std::ostream &cout, std::ostream &solution);
+
     // print outputs of the full solution
     virtual void print_full(IloCplex &cplex, std::ostream &cout = std::cout);
+
+    // true if the number of trees only changes sink arcs and right-hand sides of the built model
+    virtual bool supports_sweep();
+
+    // true if the formulation is solved by WSN::solve, where the options on the model are applied
+    // (lower bounds, root LP export, reduced cost fixing and symmetry breaking)
+    virtual bool supports_model_options();
+
+    // throws if an option on the model is set and the formulation does not apply it
+    void check_model_options();
+
+    // keep the first number_of_trees sinks of the built model and turn off the others
+    virtual void set_active_trees(int number_of_trees);
 };
 
 WSN::WSN(WSN_data &instance, std::string formulation_name, double upper_bound) : instance(instance),
@@ -124,8 +238,24 @@ void WSN::solve(bool _solve_relaxed)
     auto _name_model_instance = name_model_instance();
     std::string time_now = print::time_now();
 
+    if (use_lower_bounds && close_by_bounds(_name_model_instance, time_now, _solve_relaxed))
+    {
+        return;
+    }
+
+    auto start = perf::time::start();
+    phases.start(perf::Phase::Build);
     build_model();
+    add_symmetry_breaking();
     model.add(constraints);
+    add_reduction_fixings();
+    phases.stop();
+    build_time = perf::time::duration(start).count();
+
+    if (reduced_cost_fixing && !_solve_relaxed)
+    {
+        fix_by_reduced_costs();
+    }
 
     if (_solve_relaxed)
     {
@@ -137,6 +267,200 @@ void WSN::solve(bool _solve_relaxed)
     }
 }
 
+void WSN::solve_sweep(bool _solve_relaxed)
+{
+    if (!supports_sweep())
+    {
+        throw std::invalid_argument("Formulation " + formulation_name + " can't be reused for a different number of trees");
+    }
+
+    if (upper_bound < std::numeric_limits<double>::max())
+    {
+        throw std::invalid_argument("An upper bound is not valid for every number of trees of the sweep");
+    }
+
+    int max_trees = instance.number_trees;
+
+    auto start_build = perf::time::start();
+    phases.start(perf::Phase::Build);
+    build_model();
+    add_symmetry_breaking();
+    model.add(constraints);
+    double sweep_build_time = perf::time::duration(start_build).count();
+
+    IloModel sweep_model = _solve_relaxed ? create_relaxed() : model;
+
+    phases.start(perf::Phase::Extract);
+    IloCplex cplex(sweep_model);
+    phases.stop();
+
+    IloNumVarArray start_var(env);
+    IloNumArray start_val(env);
+
+    for (int k = 1; k <= max_trees; k++)
+    {
+        // the time to build the model is reported on the first K, the others only change it
+        if (k > 1)
+        {
+            phases.clear(perf::Phase::Build);
+        }
+
+        auto start_change = perf::time::start();
+        phases.start(perf::Phase::Build);
+        instance.set_number_trees(k);
+        set_active_trees(k);
+        phases.stop();
+        build_time = perf::time::duration(start_change).count() + ((k == 1) ? sweep_build_time : 0);
+
+        auto _name_model_instance = name_model_instance();
+        std::string time_now = print::time_now();
+
+        if (_solve_relaxed)
+        {
+            std::ofstream relaxed_out((_name_model_instance + ".relaxed.out").c_str());
+            std::ofstream relaxed_sol((_name_model_instance + ".relaxed.sol").c_str());
+
+            relaxed_out << time_now << std::endl;
+            relaxed_sol << time_now << std::endl;
+
+            cplex.setOut(relaxed_out);
+            cplex.setWarning(relaxed_out);
+            cplex.setError(relaxed_out);
+            set_solver_params(cplex);
+
+            // the basis of the previous K is kept by cplex
+            auto start = perf::time::start();
+            phases.start(perf::Phase::Solve);
+            cplex.solve();
+            auto elapsed = perf::time::duration(start).count();
+
+            phases.start(perf::Phase::Output);
+            print_relaxed_results(cplex, elapsed, relaxed_out, relaxed_sol);
+        }
+        else
+        {
+            std::ofstream cplex_out((_name_model_instance + ".log").c_str());
+            std::ofstream cplex_warn_error((_name_model_instance + ".warn.log").c_str());
+            std::ofstream solution((_name_model_instance + ".sol").c_str());
+            std::ofstream cout((_name_model_instance + ".out").c_str());
+
+            cout << time_now << std::endl;
+            solution << time_now << std::endl;
+
+            cplex.setOut(cplex_out);
+            cplex.setWarning(cplex_warn_error);
+            cplex.setError(cplex_warn_error);
+
+            auto start = perf::time::start();
+            phases.start(perf::Phase::Solve);
+            set_params_cplex(cplex);
+
+            // warm start from the solution of the previous K, cplex repairs the missing tree
+            if (start_var.getSize() > 0)
+            {
+                cplex.addMIPStart(start_var, start_val, IloCplex::MIPStartRepair);
+            }
+
+            ProgressRecorder progress;
+            CallbackDispatcher callbacks;
+            callbacks.add(&progress, IloCplex::Callback::Context::Id::GlobalProgress);
+            add_callbacks(callbacks);
+            if (symmetry_brancher.active())
+            {
+                callbacks.add(&symmetry_brancher, IloCplex::Callback::Context::Id::Branching);
+            }
+            cplex.use(&callbacks, callbacks.contexts());
+
+            cplex.solve();
+            auto elapsed = perf::time::duration(start).count();
+
+            phases.start(perf::Phase::Output);
+            cplex.use(nullptr, 0);
+            progress.add_final_sample(cplex);
+            progress.write(_name_model_instance + ".trajectory");
+
+            print_mip_results(cplex, elapsed, cout, solution);
+
+            start_var.clear();
+            start_val.clear();
+
+            if (cplex.isPrimalFeasible())
+            {
+                for (int i = 0; i < instance.n; i++)
+                {
+                    for (auto &to : instance.adj_list_from_v[i])
+                    {
+                        start_var.add(x[i][to]);
+                        start_val.add(cplex.getValue(x[i][to]));
+                    }
+
+                    for (int s = instance.n; s < x.getSize(); s++)
+                    {
+                        start_var.add(x[s][i]);
+                        start_val.add(cplex.getValue(x[s][i]));
+                    }
+
+                    start_var.add(y[i]);
+                    start_val.add(cplex.getValue(y[i]));
+                    start_var.add(z[i]);
+                    start_val.add(cplex.getValue(z[i]));
+                }
+            }
+        }
+
+        // the output streams of this K are closed at the end of the iteration
+        cplex.setOut(env.getNullStream());
+        cplex.setWarning(env.getNullStream());
+        cplex.setError(env.getNullStream());
+    }
+
+    instance.set_number_trees(max_trees);
+
+    start_var.end();
+    start_val.end();
+
+    cplex.clear();
+    cplex.end();
+}
+
+bool WSN::supports_sweep()
+{
+    return false;
+}
+
+bool WSN::supports_model_options()
+{
+    return true;
+}
+
+void WSN::check_model_options()
+{
+    if (supports_model_options())
+    {
+        return;
+    }
+
+    if (use_lower_bounds || export_root_lp || reduced_cost_fixing ||
+        symmetry != symmetry::Ordering::Formulation || symmetry_branching)
+    {
+        throw std::invalid_argument("Formulation " + formulation_name + " is not a compact model, it can not be used with " +
+                                    "--lower-bounds, --export-root-lp, --reduced-cost-fixing, --symmetry or --symmetry-branching");
+    }
+}
+
+void WSN::set_active_trees(int number_of_trees)
+{
+    forest_edges_constraint.setBounds(-number_of_trees, -number_of_trees);
+
+    for (int k = 0; k < x.getSize() - instance.n; k++)
+    {
+        for (int i = 0; i < instance.n; i++)
+        {
+            x[instance.n + k][i].setUB(k < number_of_trees ? 1 : 0);
+        }
+    }
+}
+
 void WSN::add_decision_variables()
 {
     z = IloNumVarArray(env, instance.n, 0, 1, ILOINT); // bridge
@@ -195,7 +519,9 @@ void WSN::add_number_forest_edges_constraints()
         }
     }
 
-    constraints.add(expr == N - instance.number_trees);
+    // kept as a range, so the number of trees can be changed on the built model
+    forest_edges_constraint = IloRange(env, -instance.number_trees, expr - N, -instance.number_trees);
+    constraints.add(forest_edges_constraint);
 
     expr.end();
 }
@@ -322,6 +648,20 @@ void WSN::add_trivial_tree_constraints()
     expr.end();
 }
 
+void WSN::add_bektas2014_inequalities(IloNumVarArray &pi, int n)
+{
+    for (auto &[i, j, k] : list_ordered_triangles(instance.adj_list_from_v))
+    {
+        // 3.1
+        constraints.add(pi[i] - pi[k] - (n - 1) * (x[i][j] + x[j][k]) + (n - 3) * (x[k][j] + x[j][i]) + n * x[i][k] + (n - 4) * x[k][i] <= 2 * n - 4);
+        // // 3.5 e 3.6
+        constraints.add(pi[i] - pi[k] - (2 * n - 3) * x[i][k] + (n - 4) * x[k][i] + (n - 1) * (x[i][j] + x[j][k]) <= 2 * n - 4);
+        constraints.add(pi[k] - pi[i] - (2 * n - 7) * x[i][k] + (n - 1) * x[k][i] + (n - 4) * (x[i][j] + x[j][k]) <= 2 * n - 6);
+        // // 4.3
+        constraints.add((3 * n - 7) * (x[i][k] + x[k][i]) + (n - 1) * (x[i][j] + x[j][k] + x[k][j] + x[j][i]) <= 4 * n - 8);
+    }
+}
+
 void WSN::create_basic_model_constraints()
 {
     add_decision_variables();
@@ -344,6 +684,122 @@ inline void WSN::add_upper_bound_constraint()
     constraints.add(T <= upper_bound);
 }
 
+void WSN::add_reduction_fixings()
+{
+    if (reduction == nullptr)
+    {
+        return;
+    }
+
+    for (auto &i : (*reduction).not_bridge)
+    {
+        z[i].setUB(0);
+    }
+
+    for (auto &[from, to] : (*reduction).fixed_arcs)
+    {
+        x[from][to].setUB(0);
+    }
+}
+
+bool WSN::close_by_bounds(std::string &name_model_instance, std::string time_now, bool relaxed)
+{
+    auto start = perf::time::start();
+    phases.start(perf::Phase::Solve);
+
+    auto bounds = lower_bounds::combinatorial(instance);
+    double lower_bound = bounds.value();
+
+    std::cout << "lower bound: " << lower_bound << " (masters >= " << bounds.masters
+              << ", total weight: " << bounds.total_weight << ", largest tree: " << bounds.largest_tree << ")" << std::endl;
+
+    T.setLB(lower_bound);
+
+    // the relaxation is always solved, its value is compared with the lower bound
+    if (relaxed)
+    {
+        return false;
+    }
+
+    // fixed seed, so the same instance is always closed (or not)
+    WSNConstructiveHeuristic heur(instance);
+    auto sol = with_node_lists(heur.solve(0));
+    double heuristic_value = heur.weight_of_solution();
+
+    WSN_solution solution_checker(instance);
+
+    if (!solution_checker.is_valid(sol.edges, sol.masters, sol.bridges) ||
+        heuristic_value > lower_bound + 1e-6 * std::max(1.0, std::abs(lower_bound)))
+    {
+        return false;
+    }
+
+    RunSummary run;
+
+    run.solve_time = perf::time::duration(start).count();
+    run.status = "ClosedByBounds";
+    run.objective = heuristic_value;
+    run.best_bound = lower_bound;
+    run.gap = 0;
+
+    write_results_without_solver(name_model_instance, time_now, run, &sol);
+
+    return true;
+}
+
+void WSN::write_results_without_solver(std::string &name_model_instance, std::string time_now, RunSummary &run,
+                                       SolutionHeuristic *sol)
+{
+    phases.start(perf::Phase::Output);
+
+    std::ofstream solution((name_model_instance + ".sol").c_str());
+    std::ofstream cout((name_model_instance + ".out").c_str());
+
+    cout << time_now << std::endl;
+    solution << time_now << std::endl;
+
+    cout << "time: " << run.solve_time << std::endl;
+    cout << "obj: " << run.objective << std::endl;
+    cout << "best_obj: " << run.best_bound << std::endl;
+    cout << "gap: " << (run.gap * 100) << " %" << std::endl;
+    cout << "status: " << run.status << std::endl;
+
+    if (sol != nullptr)
+    {
+        print_solution((*sol).edges, (*sol).masters, (*sol).bridges, 1, solution);
+
+        WSN_solution solution_checker(instance);
+        bool solution_valid = solution_checker.is_valid((*sol).edges, (*sol).masters, (*sol).bridges);
+
+        if (reduction != nullptr && (*reduction).is_reduced())
+        {
+            (*reduction).lift((*sol).edges, (*sol).masters, (*sol).bridges);
+
+            WSN_solution original_checker((*reduction).original);
+            solution_valid = original_checker.is_valid((*sol).edges, (*sol).masters, (*sol).bridges);
+
+            solution << "Lifted solution (original instance)" << std::endl;
+            print_solution((*sol).edges, (*sol).masters, (*sol).bridges, 1, solution);
+        }
+
+        cout << "Solution is" << (solution_valid ? "" : " not") << " valid" << std::endl;
+
+        run.valid = solution_valid ? 1 : 0;
+    }
+
+    run.time_now = print::time_now();
+    run.instance = instance.name();
+    run.n = instance.n;
+    run.model = formulation_name;
+    run.number_trees = instance.number_trees;
+    run.build_time = build_time;
+    run.run_id = run_id;
+    summary::add_resources(run, phases);
+
+    last_run = run;
+    summary::append(summary_path, run);
+}
+
 std::string WSN::name_model_instance()
 {
     return std::string(formulation_name + "_" + instance.name() + "_" + std::to_string(instance.n) + "_" + std::to_string(instance.number_trees));
@@ -368,15 +824,52 @@ void WSN::create_start_solution(IloCplex &cplex)
 
 void WSN::set_params_cplex(IloCplex &cplex)
 {
-    cplex.setParam(IloCplex::Param::TimeLimit, 600);
+    set_solver_params(cplex);
     cplex.setParam(IloCplex::Param::Conflict::Display, 2);
     // cplex.setParam(IloCplex::Param::MIP::Limits::RepairTries, 10000);
     cplex.setParam(IloCplex::Param::MIP::Tolerances::MIPGap, 1e-6);
 }
 
+void WSN::set_solver_params(IloCplex &cplex)
+{
+    cplex.setParam(IloCplex::Param::TimeLimit, solver_params.time_limit);
+    cplex.setParam(IloCplex::Param::Threads, solver_params.threads);
+    cplex.setParam(IloCplex::Param::Parallel, solver_params.parallel_mode);
+
+    if (solver_params.lp_method != 0)
+    {
+        cplex.setParam(IloCplex::Param::RootAlgorithm, solver_params.lp_method);
+    }
+
+    if (solver_params.crossover != 0)
+    {
+        cplex.setParam(IloCplex::Param::Barrier::Crossover, solver_params.crossover);
+    }
+
+    if (solver_params.work_memory > 0)
+    {
+        cplex.setParam(IloCplex::Param::WorkMem, solver_params.work_memory);
+    }
+
+    if (solver_params.node_file >= 0)
+    {
+        cplex.setParam(IloCplex::Param::MIP::Strategy::File, solver_params.node_file);
+    }
+
+    if (!solver_params.work_dir.empty())
+    {
+        cplex.setParam(IloCplex::Param::WorkDir, solver_params.work_dir.c_str());
+    }
+}
+
+void WSN::add_callbacks(CallbackDispatcher &callbacks)
+{
+}
+
 void WSN::solve_relaxed(std::string &name_model_instance, std::string time_now)
 {
     // https://www.ibm.com/support/pages/solving-linear-relaxation-mip-concert
+    phases.start(perf::Phase::Output);
     std::ofstream relaxed_out((name_model_instance + ".relaxed.out").c_str());
     std::ofstream relaxed_sol((name_model_instance + ".relaxed.sol").c_str());
 
@@ -384,40 +877,437 @@ void WSN::solve_relaxed(std::string &name_model_instance, std::string time_now)
     relaxed_sol << time_now << std::endl;
 
     // SOLVE RELAXED
+    phases.start(perf::Phase::Build);
     auto relaxed = create_relaxed();
+
+    phases.start(perf::Phase::Extract);
     IloCplex cplex_relax(relaxed);
+
+    phases.start(perf::Phase::Output);
     cplex_relax.setOut(relaxed_out);
     cplex_relax.setWarning(relaxed_out);
     cplex_relax.setError(relaxed_out);
+    set_solver_params(cplex_relax);
 
-    cplex_relax.exportModel((name_model_instance + ".relaxed.lp").c_str());
+    if (!fast_relaxed)
+    {
+        cplex_relax.exportModel((name_model_instance + ".relaxed.lp").c_str());
+    }
 
     auto start = perf::time::start();
+    phases.start(perf::Phase::Solve);
     cplex_relax.solve();
 
-    double gap = cplex_relax.getMIPRelativeGap();
-
     auto elapsed = perf::time::duration(start);
 
-    auto out_info = [&elapsed, &cplex_relax, &gap](auto &out)
+    phases.start(perf::Phase::Output);
+    print_relaxed_results(cplex_relax, elapsed.count(), relaxed_out, relaxed_sol);
+
+    cplex_relax.clear();
+    cplex_relax.end();
+}
+
+void WSN::print_relaxed_results(IloCplex &cplex, double elapsed, std::ostream &relaxed_out, std::ostream &relaxed_sol)
+{
+    double gap = cplex.getMIPRelativeGap();
+
+    auto out_info = [&elapsed, &cplex, &gap](auto &out)
     {
-        out << "time: " << elapsed.count() << std::endl;
-        out << "obj: " << cplex_relax.getObjValue() << std::endl;
+        out << "time: " << elapsed << std::endl;
+        out << "obj: " << cplex.getObjValue() << std::endl;
         out << "gap: " << (gap * 100) << " %" << std::endl;
     };
 
     out_info(relaxed_out);
     out_info(relaxed_sol);
 
-    relaxed_sol << "***************************************" << std::endl;
-    print_full(cplex_relax, relaxed_sol);
+    if (export_root_lp)
+    {
+        root_lp::write(name_model_instance() + ".relaxed.rlp", root_lp_solution(cplex));
+    }
 
-    cplex_relax.clear();
-    cplex_relax.end();
+    // the values of every variable are the largest output of the relaxation
+    if (!fast_relaxed)
+    {
+        relaxed_sol << "***************************************" << std::endl;
+        print_full(cplex, relaxed_sol);
+    }
+
+    // the last step, so the output phase is complete on the summary
+    write_summary(cplex, elapsed, true, -1);
+}
+
+root_lp::Solution WSN::root_lp_solution(IloCplex &cplex)
+{
+    root_lp::Solution s;
+
+    s.n = instance.n;
+    s.number_trees = instance.number_trees;
+    s.objective = cplex.getObjValue();
+
+    IloNumArray values(env);
+    IloNumArray reduced_costs(env);
+
+    cplex.getValues(values, y);
+    cplex.getReducedCosts(reduced_costs, y);
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        s.y_value.push_back(values[i]);
+        s.y_reduced_cost.push_back(reduced_costs[i]);
+    }
+
+    cplex.getValues(values, z);
+    cplex.getReducedCosts(reduced_costs, z);
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        s.z_value.push_back(values[i]);
+        s.z_reduced_cost.push_back(reduced_costs[i]);
+    }
+
+    IloNumVarArray arcs(env);
+    add_arc_variables(arcs, s.arc_from, s.arc_to);
+
+    cplex.getValues(values, arcs);
+    cplex.getReducedCosts(reduced_costs, arcs);
+
+    for (int a = 0; a < arcs.getSize(); a++)
+    {
+        s.arc_value.push_back(values[a]);
+        s.arc_reduced_cost.push_back(reduced_costs[a]);
+    }
+
+    // only the linear ranges of constraints have duals, row_of[r] is -1 for a logical constraint
+    IloRangeArray rows(env);
+    std::vector<int> row_of;
+
+    for (int r = 0; r < constraints.getSize(); r++)
+    {
+        auto range = dynamic_cast<IloRangeI *>(constraints[r].getImpl());
+
+        row_of.push_back(range != nullptr ? rows.getSize() : -1);
+
+        if (range != nullptr)
+        {
+            rows.add(IloRange(range));
+        }
+    }
+
+    IloNumArray duals(env);
+    cplex.getDuals(duals, rows);
+
+    for (int r = 0; r < constraints.getSize(); r++)
+    {
+        s.duals.push_back(row_of[r] < 0 ? std::numeric_limits<double>::quiet_NaN() : duals[row_of[r]]);
+    }
+
+    values.end();
+    reduced_costs.end();
+    duals.end();
+    arcs.end();
+    rows.end();
+
+    return s;
+}
+
+void WSN::add_arc_variables(IloNumVarArray &arcs, std::vector<int> &from, std::vector<int> &to)
+{
+    // as on the warm start of solve_sweep
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (auto &j : instance.adj_list_from_v[i])
+        {
+            arcs.add(x[i][j]);
+            from.push_back(i);
+            to.push_back(j);
+        }
+    }
+
+    for (int k = instance.n; k < x.getSize(); k++)
+    {
+        for (int i = 0; i < instance.n; i++)
+        {
+            arcs.add(x[k][i]);
+            from.push_back(k);
+            to.push_back(i);
+        }
+    }
+}
+
+void WSN::set_per_sink_variables(IloArray<IloArray<IloNumVarArray>> &arcs, std::vector<int> sink_row, std::vector<int> first_node)
+{
+    sink_arcs = arcs;
+    per_sink_nodes = false;
+
+    this->sink_row = sink_row;
+    sink_first_node = first_node.empty() ? std::vector<int>(sink_row.size(), 0) : first_node;
+}
+
+void WSN::set_per_sink_variables(IloArray<IloArray<IloNumVarArray>> &arcs, IloArray<IloNumVarArray> &masters, IloArray<IloNumVarArray> &bridges,
+                                 std::vector<int> sink_row, std::vector<int> first_node)
+{
+    set_per_sink_variables(arcs, sink_row, first_node);
+
+    sink_masters = masters;
+    sink_bridges = bridges;
+    per_sink_nodes = true;
+}
+
+void WSN::add_per_sink_variables(IloNumVarArray &variables)
+{
+    for (int k = 0; k < (int)sink_row.size(); k++)
+    {
+        int first = sink_first_node[k];
+
+        for (int i = first; i < instance.n; i++)
+        {
+            for (auto &j : instance.adj_list_from_v[i])
+            {
+                if (j >= first)
+                {
+                    variables.add(sink_arcs[k][i][j]);
+                }
+            }
+
+            if (sink_row[k] >= 0)
+            {
+                variables.add(sink_arcs[k][sink_row[k]][i]);
+            }
+
+            if (per_sink_nodes)
+            {
+                variables.add(sink_masters[k][i]);
+                variables.add(sink_bridges[k][i]);
+            }
+        }
+    }
+}
+
+void WSN::fix_by_reduced_costs()
+{
+    phases.start(perf::Phase::Solve);
+
+    // fixed seed, as on close_by_bounds
+    WSNConstructiveHeuristic heur(instance);
+    auto sol = with_node_lists(heur.solve(0));
+
+    WSN_solution solution_checker(instance);
+    double bound = upper_bound;
+
+    if (solution_checker.is_valid(sol.edges, sol.masters, sol.bridges))
+    {
+        bound = std::min(bound, heur.weight_of_solution());
+    }
+
+    fixed_variables = 0;
+
+    if (bound >= std::numeric_limits<double>::max())
+    {
+        std::cout << "reduced cost fixing: no upper bound" << std::endl;
+        return;
+    }
+
+    IloNumVarArray variables(env);
+    std::vector<int> from, to;
+
+    add_arc_variables(variables, from, to);
+    variables.add(y);
+    variables.add(z);
+    add_per_sink_variables(variables);
+
+    auto relaxed = create_relaxed();
+    IloCplex cplex(relaxed);
+
+    cplex.setOut(env.getNullStream());
+    cplex.setWarning(env.getNullStream());
+    set_solver_params(cplex);
+
+    if (!cplex.solve() || cplex.getStatus() != IloAlgorithm::Optimal)
+    {
+        std::cout << "reduced cost fixing: the root relaxation was not solved (" << cplex.getStatus() << ")" << std::endl;
+
+        cplex.end();
+        relaxed.end();
+        variables.end();
+        return;
+    }
+
+    double objective = cplex.getObjValue();
+
+    IloNumArray values(env);
+    IloNumArray reduced_costs(env);
+
+    cplex.getValues(values, variables);
+    cplex.getReducedCosts(reduced_costs, variables);
+
+    std::vector<double> value_of(variables.getSize());
+    std::vector<double> reduced_cost_of(variables.getSize());
+
+    for (int v = 0; v < variables.getSize(); v++)
+    {
+        value_of[v] = values[v];
+        reduced_cost_of[v] = reduced_costs[v];
+    }
+
+    cplex.end();
+    relaxed.end();
+
+    // the bounds are changed on the variables of the model, before the mip is extracted
+    auto fixings = root_lp::reduced_cost_fixings(value_of, reduced_cost_of, objective, bound);
+
+    for (int v = 0; v < variables.getSize(); v++)
+    {
+        if (fixings[v] == 0)
+        {
+            variables[v].setUB(0);
+            fixed_variables++;
+        }
+        else if (fixings[v] == 1)
+        {
+            variables[v].setLB(1);
+            fixed_variables++;
+        }
+    }
+
+    std::cout << "reduced cost fixing: " << fixed_variables << " of " << variables.getSize()
+              << " variables fixed (root LP: " << objective << ", upper bound: " << bound << ")" << std::endl;
+
+    values.end();
+    reduced_costs.end();
+    variables.end();
+}
+
+IloArray<IloExprArray> WSN::symmetry_keys(symmetry::Ordering ordering)
+{
+    // the per-sink variables of the representative formulations are not indexed by the trees
+    bool by_tree = (int)sink_row.size() == instance.number_trees &&
+                   std::all_of(sink_row.begin(), sink_row.end(), [](int row) { return row >= 0; });
+
+    if (ordering != symmetry::Ordering::Root && !(by_tree && per_sink_nodes))
+    {
+        throw std::invalid_argument("Formulation " + formulation_name + " does not assign the nodes to the sinks, only the root order can be used");
+    }
+
+    IloArray<IloExprArray> keys(env, instance.number_trees);
+
+    for (int k = 0; k < instance.number_trees; k++)
+    {
+        keys[k] = IloExprArray(env, instance.n);
+
+        for (int v = 0; v < instance.n; v++)
+        {
+            if (ordering == symmetry::Ordering::Tree)
+            {
+                keys[k][v] = sink_masters[k][v] + sink_bridges[k][v];
+            }
+            else if (by_tree)
+            {
+                keys[k][v] = IloExpr(sink_arcs[k][sink_row[k]][v]);
+            }
+            else
+            {
+                keys[k][v] = IloExpr(x[instance.n + k][v]);
+            }
+        }
+    }
+
+    return keys;
+}
+
+void WSN::add_symmetry_breaking()
+{
+    auto ordering = symmetry;
+
+    if (symmetry_branching && ordering == symmetry::Ordering::Formulation)
+    {
+        throw std::invalid_argument("--symmetry-branching needs the order of the trees (--symmetry root | tree)");
+    }
+
+    if (ordering == symmetry::Ordering::Formulation || ordering == symmetry::Ordering::None)
+    {
+        return;
+    }
+
+    auto keys = symmetry_keys(ordering);
+
+    if (symmetry_branching)
+    {
+        symmetry_brancher.set_keys(keys);
+        std::cout << "symmetry: " << symmetry::ordering_name(ordering) << " order by branching" << std::endl;
+        return;
+    }
+
+    // the tree k - 1 has a node smaller than every node of the tree k
+    IloExpr smaller(env);
+
+    for (int k = 1; k < instance.number_trees; k++)
+    {
+        for (int v = 0; v < instance.n; v++)
+        {
+            constraints.add(keys[k][v] <= smaller);
+            smaller += keys[k - 1][v];
+        }
+
+        smaller.end();
+        smaller = IloExpr(env);
+    }
+
+    smaller.end();
+
+    std::cout << "symmetry: " << symmetry::ordering_name(ordering) << " order, "
+              << (instance.number_trees - 1) * instance.n << " rows" << std::endl;
+}
+
+void WSN::write_summary(IloCplex &cplex, double elapsed, bool relaxed, int valid)
+{
+    RunSummary run;
+
+    run.time_now = print::time_now();
+    run.instance = instance.name();
+    run.n = instance.n;
+    run.model = formulation_name;
+    run.number_trees = instance.number_trees;
+    run.relaxed = relaxed;
+
+    run.build_time = build_time;
+    run.solve_time = elapsed;
+
+    std::ostringstream status;
+    status << cplex.getStatus();
+    run.status = status.str();
+
+    if (cplex.isPrimalFeasible())
+    {
+        run.objective = cplex.getObjValue();
+    }
+
+    if (relaxed)
+    {
+        run.best_bound = run.objective;
+    }
+    else
+    {
+        run.best_bound = cplex.getBestObjValue();
+        run.gap = cplex.getMIPRelativeGap();
+        run.nodes = cplex.getNnodes();
+    }
+
+    run.rows = cplex.getNrows();
+    run.cols = cplex.getNcols();
+    run.nonzeros = cplex.getNNZs();
+    run.valid = valid;
+    run.run_id = run_id;
+    run.fixed = relaxed ? 0 : fixed_variables;
+    summary::add_resources(run, phases);
+
+    last_run = run;
+    summary::append(summary_path, run);
 }
 
 void WSN::solve_mip(std::string &name_model_instance, std::string time_now)
 {
+    phases.start(perf::Phase::Output);
     std::ofstream cplex_out((name_model_instance + ".log").c_str());
     std::ofstream cplex_warn_error((name_model_instance + ".warn.log").c_str());
     std::ofstream solution((name_model_instance + ".sol").c_str());
@@ -427,8 +1317,10 @@ void WSN::solve_mip(std::string &name_model_instance, std::string time_now)
     solution << time_now << std::endl;
 
     // SOLVE ORIGINAL MODEL
+    phases.start(perf::Phase::Extract);
     IloCplex cplex(model);
 
+    phases.start(perf::Phase::Output);
     cplex.setOut(cplex_out);
     cplex.setWarning(cplex_warn_error);
     cplex.setError(cplex_warn_error);
@@ -436,22 +1328,50 @@ void WSN::solve_mip(std::string &name_model_instance, std::string time_now)
     cplex.exportModel((name_model_instance + ".lp").c_str());
 
     auto start = perf::time::start();
+    phases.start(perf::Phase::Solve);
     set_params_cplex(cplex);
 
     create_start_solution(cplex);
 
-    cplex.solve();
+    ProgressRecorder progress;
+    CallbackDispatcher callbacks;
+    callbacks.add(&progress, IloCplex::Callback::Context::Id::GlobalProgress);
+    add_callbacks(callbacks);
+    if (symmetry_brancher.active())
+    {
+        callbacks.add(&symmetry_brancher, IloCplex::Callback::Context::Id::Branching);
+    }
+    cplex.use(&callbacks, callbacks.contexts());
 
-    double gap = cplex.getMIPRelativeGap();
+    cplex.solve();
 
     auto elapsed = perf::time::duration(start).count();
 
+    phases.start(perf::Phase::Output);
+    progress.add_final_sample(cplex);
+    progress.write(name_model_instance + ".trajectory");
+
+    print_mip_results(cplex, elapsed, cout, solution);
+
+    cplex.clear();
+    cplex.end();
+}
+
+void WSN::print_mip_results(IloCplex &cplex, double elapsed, std::ostream &cout, std::ostream &solution)
+{
+    double gap = cplex.getMIPRelativeGap();
+
     cout << "time: " << elapsed << std::endl;
     cout << "obj: " << cplex.getObjValue() << std::endl;
     cout << "best_obj: " << cplex.getBestObjValue() << std::endl;
     cout << "gap: " << (gap * 100) << " %" << std::endl;
     cout << "status: " << cplex.getStatus() << std::endl;
 
+    if (symmetry_brancher.active())
+    {
+        cout << "symmetry branches: " << symmetry_brancher.number_of_branches() << std::endl;
+    }
+
     print_solution(cplex, x, y, z, instance, 1, solution);
 
     WSN_solution solution_checker(instance);
@@ -464,11 +1384,24 @@ void WSN::solve_mip(std::string &name_model_instance, std::string time_now)
 
     cout << "Solution is" << (solution_valid ? "" : " not") << " valid" << std::endl;
 
+    if (reduction != nullptr && (*reduction).is_reduced())
+    {
+        (*reduction).lift(matrix_x, vec_y, vec_z);
+
+        WSN_solution original_checker((*reduction).original);
+        solution_valid = original_checker.is_valid(matrix_x, vec_y, vec_z);
+
+        solution << "Lifted solution (original instance)" << std::endl;
+        print_solution(matrix_x, vec_y, vec_z, 1, solution);
+
+        cout << "Lifted solution is" << (solution_valid ? "" : " not") << " valid" << std::endl;
+    }
+
     cout << "***************************************" << std::endl;
     print_full(cplex, cout);
 
-    cplex.clear();
-    cplex.end();
+    // the last step, so the output phase is complete on the summary
+    write_summary(cplex, elapsed, false, solution_valid ? 1 : 0);
 }
 
 void WSN::print_full(IloCplex &cplex, std::ostream &cout)
@@ -189,6 +189,9 @@ inline void WSN_arvore_rotulada_model_base::add_mar_model_variables()
             z_sink[k][i].setName(("z_sink(" + std::to_string(k) + ")(" + std::to_string(i) + ")").c_str());
         }
     }
+
+    // the arcs of the sinks are on the row n of x_sink[k]
+    set_per_sink_variables(x_sink, y_sink, z_sink, std::vector<int>(instance.number_trees, instance.n));
 }
 
 inline void WSN_arvore_rotulada_model_base::add_flow_model_variables()
@@ -290,25 +293,7 @@ void WSN_arvore_rotulada_model_base::add_mtz_bektas2014_inequalities()
 {
     int n = instance.n;
     // restricoes Bektas2014
-    for (int i = 0; i < instance.n; i++)
-    {
-        for (int j = 0; j < instance.n; j++)
-        {
-            for (int k = 0; k < instance.n; k++)
-            {
-                if ((instance.is_connected[i][j] == 1) & (instance.is_connected[j][k] == 1) & (instance.is_connected[i][k] == 1))
-                {
-                    // 3.1
-                    constraints.add(pi[i] - pi[k] - (n - 1) * (x[i][j] + x[j][k]) + (n - 3) * (x[k][j] + x[j][i]) + n * x[i][k] + (n - 4) * x[k][i] <= 2 * n - 4);
-                    // // 3.5 e 3.6
-                    constraints.add(pi[i] - pi[k] - (2 * n - 3) * x[i][k] + (n - 4) * x[k][i] + (n - 1) * (x[i][j] + x[j][k]) <= 2 * n - 4);
-                    constraints.add(pi[k] - pi[i] - (2 * n - 7) * x[i][k] + (n - 1) * x[k][i] + (n - 4) * (x[i][j] + x[j][k]) <= 2 * n - 6);
-                    // // 4.3
-                    constraints.add((3 * n - 7) * (x[i][k] + x[k][i]) + (n - 1) * (x[i][j] + x[j][k] + x[k][j] + x[j][i]) <= 4 * n - 8);
-                }
-            }
-        }
-    }
+    add_bektas2014_inequalities(pi, n);
 }
 
 inline void WSN_arvore_rotulada_model_base::add_ahani2019_mcf_constraints()
@@ -596,8 +581,26 @@ void WSN_arvore_rotulada_model_base::add_testing_valid_inequalities()
     expr.end();
 }
 
+inline IloModel WSN_arvore_rotulada_model_base::create_relaxed()
+{
+    IloModel relaxed(WSN::create_relaxed());
+
+    relaxed = relax_utils::relax_2_index(relaxed, y_sink);
+    relaxed = relax_utils::relax_2_index(relaxed, z_sink);
+
+    relaxed = relax_utils::relax_3_index(relaxed, x_sink);
+
+    return relaxed;
+}
+
 void WSN_arvore_rotulada_model_base::add_remove_symmetries()
 {
+    // an order chosen with --symmetry replaces test_5 (see WSN::add_symmetry_breaking)
+    if (symmetry != symmetry::Ordering::Formulation)
+    {
+        return;
+    }
+
     // adapted from work of Robertty
     IloExpr expr(env);
 
@@ -629,18 +632,6 @@ void WSN_arvore_rotulada_model_base::add_remove_symmetries()
     expr.end();
 }
 
-inline IloModel WSN_arvore_rotulada_model_base::create_relaxed()
-{
-    IloModel relaxed(WSN::create_relaxed());
-
-    relaxed = relax_utils::relax_2_index(relaxed, y_sink);
-    relaxed = relax_utils::relax_2_index(relaxed, z_sink);
-
-    relaxed = relax_utils::relax_3_index(relaxed, x_sink);
-
-    return relaxed;
-}
-
 void WSN_arvore_rotulada_model_base::print_full(IloCplex &cplex, std::ostream &cout)
 {
     WSN::print_full(cplex, cout);
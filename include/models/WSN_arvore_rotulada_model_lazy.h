@@ -0,0 +1,279 @@
+#pragma once
+
+#include "WSN_arvore_rotulada_model_base.h"
+#include "util_connectivity.h"
+
+#include <memory>
+
+/**
+ * @brief Generic callback that separates the connectivity cuts x(in(S)) >= y(v) + z(v),
+ * where in(S) are the arcs (including the sink arcs) that enter the set of nodes S and v is in S.
+ * Integer solutions with subtours are rejected (lazy constraints) and, optionally, fractional
+ * solutions of the root node are separated by min-cut (user cuts).
+ *
+ */
+class SubtourSeparator : public IloCplex::Callback::Function
+{
+public:
+    SubtourSeparator(WSN_data &instance, IloArray<IloNumVarArray> x,
+                     IloNumVarArray y, IloNumVarArray z, bool fractional_cuts);
+
+    // contexts where the separator must be invoked
+    CPXLONG contexts();
+
+    void invoke(const IloCplex::Callback::Context &context) override;
+
+    // the cut x(in(S)) >= y(v) + z(v)
+    IloRange connectivity_cut(IloEnv env, std::vector<int> &set, int v);
+
+private:
+    WSN_data &instance;
+    IloArray<IloNumVarArray> x;
+    IloNumVarArray y;
+    IloNumVarArray z;
+    bool fractional_cuts;
+
+    void separate_candidate(const IloCplex::Callback::Context &context);
+    void separate_relaxation(const IloCplex::Callback::Context &context);
+};
+
+SubtourSeparator::SubtourSeparator(WSN_data &instance, IloArray<IloNumVarArray> x,
+                                   IloNumVarArray y, IloNumVarArray z,
+                                   bool fractional_cuts) : instance(instance), x(x), y(y), z(z),
+                                                           fractional_cuts(fractional_cuts)
+{
+}
+
+CPXLONG SubtourSeparator::contexts()
+{
+    CPXLONG contexts = IloCplex::Callback::Context::Id::Candidate;
+
+    if (fractional_cuts)
+    {
+        contexts |= IloCplex::Callback::Context::Id::Relaxation;
+    }
+
+    return contexts;
+}
+
+void SubtourSeparator::invoke(const IloCplex::Callback::Context &context)
+{
+    if (context.inCandidate())
+    {
+        separate_candidate(context);
+    }
+    else if (context.inRelaxation() && fractional_cuts)
+    {
+        separate_relaxation(context);
+    }
+}
+
+void SubtourSeparator::separate_candidate(const IloCplex::Callback::Context &context)
+{
+    if (!context.isCandidatePoint())
+    {
+        return;
+    }
+
+    ArcValues arc_value(instance);
+    std::vector<double> sink_value(instance.n, 0.0);
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (int p = 0; p < arc_value.degree(i); p++)
+        {
+            arc_value.at(i, p) = context.getCandidatePoint(x[i][arc_value.head(i, p)]);
+        }
+
+        for (int k = 0; k < instance.number_trees; k++)
+        {
+            sink_value[i] += context.getCandidatePoint(x[instance.n + k][i]);
+        }
+    }
+
+    auto subtours = connectivity::find_subtours(instance, arc_value, sink_value);
+
+    if (subtours.empty())
+    {
+        return;
+    }
+
+    IloEnv env = context.getEnv();
+    IloRangeArray cuts(env);
+
+    for (auto &subtour : subtours)
+    {
+        // every node of a subtour is dominating, so any of them gives a violated cut
+        cuts.add(connectivity_cut(env, subtour, subtour.front()));
+    }
+
+    context.rejectCandidate(cuts);
+
+    cuts.endElements();
+    cuts.end();
+}
+
+void SubtourSeparator::separate_relaxation(const IloCplex::Callback::Context &context)
+{
+    // min-cut separation is expensive (one max flow by node), so it is done only at the root
+    if (context.getLongInfo(IloCplex::Callback::Context::Info::NodeDepth) > 0)
+    {
+        return;
+    }
+
+    ArcValues arc_value(instance);
+    std::vector<double> sink_value(instance.n, 0.0);
+    std::vector<double> demand(instance.n, 0.0);
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (int p = 0; p < arc_value.degree(i); p++)
+        {
+            arc_value.at(i, p) = context.getRelaxationPoint(x[i][arc_value.head(i, p)]);
+        }
+
+        for (int k = 0; k < instance.number_trees; k++)
+        {
+            sink_value[i] += context.getRelaxationPoint(x[instance.n + k][i]);
+        }
+
+        demand[i] = context.getRelaxationPoint(y[i]) + context.getRelaxationPoint(z[i]);
+    }
+
+    auto cuts = connectivity::separate_min_cuts(instance, arc_value, sink_value, demand);
+
+    IloEnv env = context.getEnv();
+
+    for (auto &[v, set] : cuts)
+    {
+        IloRange cut = connectivity_cut(env, set, v);
+
+        context.addUserCut(cut, IloCplex::UseCutPurge, IloFalse);
+
+        cut.end();
+    }
+}
+
+IloRange SubtourSeparator::connectivity_cut(IloEnv env, std::vector<int> &set, int v)
+{
+    std::vector<bool> in_set(instance.n, false);
+    for (auto &i : set)
+    {
+        in_set[i] = true;
+    }
+
+    IloExpr expr(env);
+
+    for (auto &j : set)
+    {
+        for (auto &from : instance.adj_list_to_v[j])
+        {
+            if (!in_set[from])
+            {
+                expr += x[from][j];
+            }
+        }
+
+        for (int k = 0; k < instance.number_trees; k++)
+        {
+            expr += x[instance.n + k][j];
+        }
+    }
+
+    expr -= (y[v] + z[v]);
+
+    IloRange cut(env, 0, expr, IloInfinity);
+
+    expr.end();
+
+    return cut;
+}
+
+/**
+ * @brief Labeled tree formulation without compact subtour elimination (MTZ or flow).
+ * The subtours are removed by connectivity cuts separated on a callback, so the model
+ * solved by cplex has only the core constraints and the tree assignment.
+ * The relaxed solve does not use callbacks, so it is the bound without connectivity cuts.
+ *
+ */
+class WSN_arv_rot_model_lazy : public WSN_arvore_rotulada_model_base
+{
+public:
+    WSN_arv_rot_model_lazy(WSN_data &instance);
+    WSN_arv_rot_model_lazy(WSN_data &instance, double upper_bound);
+
+protected:
+    // separate also the fractional solutions (min-cut)
+    bool fractional_cuts;
+
+    std::shared_ptr<SubtourSeparator> separator;
+
+    virtual void build_model();
+    virtual void add_callbacks(CallbackDispatcher &callbacks);
+};
+
+WSN_arv_rot_model_lazy::WSN_arv_rot_model_lazy(WSN_data &instance) : WSN_arvore_rotulada_model_base(instance),
+                                                                     fractional_cuts(false)
+{
+    WSN::formulation_name = "MAR-lazy";
+}
+
+WSN_arv_rot_model_lazy::WSN_arv_rot_model_lazy(WSN_data &instance,
+                                               double upper_bound) : WSN_arvore_rotulada_model_base(instance, upper_bound),
+                                                                     fractional_cuts(false)
+{
+    WSN::formulation_name = "MAR-lazy";
+}
+
+inline void WSN_arv_rot_model_lazy::build_model()
+{
+    // basic model
+    add_decision_variables();
+    add_number_dominating_nodes_constraints();
+    add_number_forest_edges_constraints();
+    add_in_coming_edge_constraints();
+    add_node_master_or_bridge_constraints();
+    add_master_neighbor_constraints();
+    add_master_not_adj_master_constraints();
+    add_bridges_not_neighbor_constraints();
+    add_bridge_master_neighbor_constraints();
+    add_upper_bound_constraint();
+
+    add_trivial_tree_constraints();
+
+    // mar model
+    add_mar_model_variables();
+    add_ahani2019_mcf_constraints();
+    add_connect_sink_assignment_constraints();
+
+    // remove subtours - connectivity cuts on callback (add_callbacks)
+
+    add_objective_function();
+}
+
+void WSN_arv_rot_model_lazy::add_callbacks(CallbackDispatcher &callbacks)
+{
+    separator = std::make_shared<SubtourSeparator>(instance, x, y, z, fractional_cuts);
+
+    callbacks.add(separator.get(), separator->contexts());
+}
+
+class WSN_arv_rot_model_lazy_cut : public WSN_arv_rot_model_lazy
+{
+public:
+    WSN_arv_rot_model_lazy_cut(WSN_data &instance);
+    WSN_arv_rot_model_lazy_cut(WSN_data &instance, double upper_bound);
+};
+
+WSN_arv_rot_model_lazy_cut::WSN_arv_rot_model_lazy_cut(WSN_data &instance) : WSN_arv_rot_model_lazy(instance)
+{
+    WSN::formulation_name = "MAR-lazy-cut";
+    fractional_cuts = true;
+}
+
+WSN_arv_rot_model_lazy_cut::WSN_arv_rot_model_lazy_cut(WSN_data &instance,
+                                                       double upper_bound) : WSN_arv_rot_model_lazy(instance, upper_bound)
+{
+    WSN::formulation_name = "MAR-lazy-cut";
+    fractional_cuts = true;
+}
@@ -0,0 +1,213 @@
+#pragma once
+
+#include "WSN.h"
+#include "WSN_arvore_rotulada_model_lazy.h"
+#include "util_benders.h"
+
+#include <memory>
+
+/**
+ * @brief Generic callback that solves the Benders subproblem (util_benders.h) on each integer
+ * solution of the master. Subtours are cut by feasibility cuts x(in(S)) >= y(v) + z(v) and the
+ * trees heavier than T by optimality cuts T >= W - sum c(a) (1 - x(a)).
+ *
+ */
+class BendersSeparator : public IloCplex::Callback::Function
+{
+public:
+    BendersSeparator(WSN_data &instance, IloArray<IloNumVarArray> x, IloNumVarArray y, IloNumVarArray z, IloNumVar T);
+
+    void invoke(const IloCplex::Callback::Context &context) override;
+
+private:
+    WSN_data &instance;
+    IloArray<IloNumVarArray> x;
+    IloNumVar T;
+
+    // builds the feasibility cuts
+    SubtourSeparator feasibility;
+
+    IloRange optimality_cut(IloEnv env, const benders::Tree &tree);
+};
+
+BendersSeparator::BendersSeparator(WSN_data &instance, IloArray<IloNumVarArray> x, IloNumVarArray y,
+                                   IloNumVarArray z, IloNumVar T) : instance(instance), x(x), T(T),
+                                                                    feasibility(instance, x, y, z, false)
+{
+}
+
+void BendersSeparator::invoke(const IloCplex::Callback::Context &context)
+{
+    if (!context.inCandidate() || !context.isCandidatePoint())
+    {
+        return;
+    }
+
+    ArcValues arc_value(instance);
+    std::vector<double> sink_value(instance.n, 0.0);
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (int p = 0; p < arc_value.degree(i); p++)
+        {
+            arc_value.at(i, p) = context.getCandidatePoint(x[i][arc_value.head(i, p)]);
+        }
+
+        for (int k = 0; k < instance.number_trees; k++)
+        {
+            sink_value[i] += context.getCandidatePoint(x[instance.n + k][i]);
+        }
+    }
+
+    auto subproblem = benders::solve_subproblem(instance, arc_value, sink_value);
+
+    IloEnv env = context.getEnv();
+    IloRangeArray cuts(env);
+
+    for (auto &subtour : subproblem.subtours)
+    {
+        cuts.add(feasibility.connectivity_cut(env, subtour, subtour.front()));
+    }
+
+    double T_value = context.getCandidatePoint(T);
+
+    for (auto &tree : subproblem.trees)
+    {
+        if (tree.weight > T_value + 1e-6)
+        {
+            cuts.add(optimality_cut(env, tree));
+        }
+    }
+
+    if (cuts.getSize() > 0)
+    {
+        context.rejectCandidate(cuts);
+    }
+
+    cuts.endElements();
+    cuts.end();
+}
+
+IloRange BendersSeparator::optimality_cut(IloEnv env, const benders::Tree &tree)
+{
+    IloExpr expr(env);
+    double rhs = tree.weight;
+
+    // T + sum c(a) (1 - x(a)) >= W
+    expr += T;
+    for (size_t a = 0; a < tree.arcs.size(); a++)
+    {
+        auto [i, j] = tree.arcs[a];
+
+        expr -= tree.coefficient[a] * x[i][j];
+        rhs -= tree.coefficient[a];
+    }
+
+    IloRange cut(env, rhs, expr, IloInfinity);
+
+    expr.end();
+
+    return cut;
+}
+
+/**
+ * @brief Benders decomposition with the arcs, the roles (y, z) and the sink assignment on the
+ * master, and the connectivity and weight of the trees on a subproblem solved on a callback.
+ * The flow variables of the compact models, whose number grows with K, are not created.
+ * The relaxed solve does not use callbacks, so it is the bound of the master alone.
+ *
+ */
+class WSN_benders : public WSN
+{
+public:
+    WSN_benders(WSN_data &instance);
+    WSN_benders(WSN_data &instance, double upper_bound);
+
+    // protected:
+    std::shared_ptr<BendersSeparator> separator;
+
+    virtual void build_model();
+    virtual void add_objective_function();
+
+    // each sink is connected to exactly one node
+    void add_sink_assignment_constraints();
+
+    // the arcs that leave a node are in the same tree (T >= weight of arcs out of a node)
+    void add_lower_bound_constraints();
+
+    virtual void add_callbacks(CallbackDispatcher &callbacks);
+};
+
+WSN_benders::WSN_benders(WSN_data &instance) : WSN(instance, "Benders")
+{
+}
+
+WSN_benders::WSN_benders(WSN_data &instance, double upper_bound) : WSN(instance, "Benders", upper_bound)
+{
+}
+
+void WSN_benders::build_model()
+{
+    create_basic_model_constraints();
+
+    add_sink_assignment_constraints();
+    add_lower_bound_constraints();
+
+    // connectivity and weight of the trees - Benders cuts on callback (add_callbacks)
+
+    add_objective_function();
+}
+
+void WSN_benders::add_objective_function()
+{
+    T.setName("T");
+
+    model.add(IloMinimize(env, T));
+}
+
+void WSN_benders::add_sink_assignment_constraints()
+{
+    IloExpr expr(env);
+
+    for (int k = 0; k < instance.number_trees; k++)
+    {
+        for (int i = 0; i < instance.n; i++)
+        {
+            expr += x[instance.n + k][i];
+        }
+
+        constraints.add(expr == 1);
+
+        expr.end();
+        expr = IloExpr(env);
+    }
+
+    expr.end();
+}
+
+void WSN_benders::add_lower_bound_constraints()
+{
+    IloExpr expr(env);
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (auto &to : instance.adj_list_from_v[i])
+        {
+            expr += instance.weight[i][to] * x[i][to];
+        }
+
+        constraints.add(T >= expr);
+
+        expr.end();
+        expr = IloExpr(env);
+    }
+
+    expr.end();
+}
+
+void WSN_benders::add_callbacks(CallbackDispatcher &callbacks)
+{
+    separator = std::make_shared<BendersSeparator>(instance, x, y, z, T);
+
+    callbacks.add(separator.get(), IloCplex::Callback::Context::Id::Candidate);
+}
@@ -0,0 +1,701 @@
+#pragma once
+
+#include "WSN.h"
+#include "util_column_generation.h"
+#include "util_lagrangian.h"
+
+#include <set>
+
+/**
+ * @brief Exact pricing of the tree columns: a mip over a single tree (rooted at a master and
+ * connected by a single-commodity flow from the root) with weight at most the cap, maximizing
+ * the score of the column on the duals of the master problem.
+ *
+ */
+class TreePricing
+{
+public:
+    TreePricing(WSN_data &instance, IloEnv env);
+
+    /**
+     * @brief Find the column with the largest score
+     *
+     * @param duals are the duals of the master problem
+     * @param cap is the maximum weight of the tree
+     * @param column is the column found (output)
+     * @return double is the score of the column (-infinity if the pricing was not solved)
+     */
+    double solve(const column_generation::Duals &duals, double cap, column_generation::Column &column);
+
+    // true if the last pricing was solved to optimality (the bound of the master is valid)
+    bool optimal = true;
+
+    IloCplex cplex;
+
+private:
+    WSN_data &instance;
+    IloEnv env;
+    IloModel model;
+
+    IloNumVarArray y; // master
+    IloNumVarArray z; // bridge
+    IloNumVarArray u; // dominated by the tree
+    IloNumVarArray r; // root (master connected to the sink)
+    IloNumVarArray q; // flow sent by the root
+    IloArray<IloNumVarArray> x; // arcs
+    IloArray<IloNumVarArray> g; // flow on the arcs
+
+    IloRange weight_limit;
+    IloObjective objective;
+
+    std::vector<std::vector<int>> neighbors;
+};
+
+TreePricing::TreePricing(WSN_data &instance, IloEnv env) : instance(instance), env(env), model(IloModel(env)),
+                                                           y(IloNumVarArray(env, instance.n, 0, 1, ILOINT)),
+                                                           z(IloNumVarArray(env, instance.n, 0, 1, ILOINT)),
+                                                           u(IloNumVarArray(env, instance.n, 0, 1, ILOFLOAT)),
+                                                           r(IloNumVarArray(env, instance.n, 0, 1, ILOINT)),
+                                                           q(IloNumVarArray(env, instance.n, 0, instance.n, ILOFLOAT)),
+                                                           x(IloArray<IloNumVarArray>(env, instance.n)),
+                                                           g(IloArray<IloNumVarArray>(env, instance.n)),
+                                                           neighbors(column_generation::undirected_neighbors(instance))
+{
+    int n = instance.n;
+
+    for (int i = 0; i < n; i++)
+    {
+        x[i] = IloNumVarArray(env, n, 0, 1, ILOINT);
+        g[i] = IloNumVarArray(env, n, 0, n, ILOFLOAT);
+    }
+
+    IloExpr expr(env);
+
+    for (int i = 0; i < n; i++)
+    {
+        model.add(y[i] + z[i] <= 1);
+        model.add(r[i] <= y[i]);
+        model.add(q[i] <= n * r[i]);
+
+        // one incoming arc (or the sink) for each node of the tree, and the flow reaches it
+        for (auto &from : instance.adj_list_to_v[i])
+        {
+            expr += x[from][i];
+        }
+        model.add(expr + r[i] == y[i] + z[i]);
+        expr.end();
+        expr = IloExpr(env);
+
+        for (auto &from : instance.adj_list_to_v[i])
+        {
+            expr += g[from][i];
+        }
+        for (auto &to : instance.adj_list_from_v[i])
+        {
+            expr -= g[i][to];
+        }
+        model.add(expr + q[i] == y[i] + z[i]);
+        expr.end();
+        expr = IloExpr(env);
+
+        // a bridge has at least two arcs
+        for (auto &to : instance.adj_list_from_v[i])
+        {
+            expr += x[i][to];
+        }
+        for (auto &from : instance.adj_list_to_v[i])
+        {
+            expr += x[from][i];
+        }
+        model.add(2 * z[i] <= expr);
+        expr.end();
+        expr = IloExpr(env);
+
+        // dominated by a master of the tree
+        expr += y[i];
+        for (auto &from : instance.adj_list_to_v[i])
+        {
+            expr += y[from];
+        }
+        model.add(u[i] <= expr);
+        expr.end();
+        expr = IloExpr(env);
+
+        for (auto &j : neighbors[i])
+        {
+            if (j > i)
+            {
+                model.add(y[i] + y[j] <= 1);
+            }
+        }
+
+        for (auto &to : instance.adj_list_from_v[i])
+        {
+            model.add(x[i][to] <= y[i] + y[to]);
+            model.add(x[i][to] <= z[i] + z[to]);
+            model.add(g[i][to] <= n * x[i][to]);
+
+            expr += instance.weight[i][to] * x[i][to];
+        }
+    }
+
+    weight_limit = IloRange(env, 0, expr, IloInfinity);
+    model.add(weight_limit);
+    expr.end();
+
+    expr = IloExpr(env);
+    for (int i = 0; i < n; i++)
+    {
+        expr += r[i];
+    }
+    model.add(expr == 1);
+    expr.end();
+
+    objective = IloMaximize(env);
+    model.add(objective);
+
+    cplex = IloCplex(model);
+}
+
+double TreePricing::solve(const column_generation::Duals &duals, double cap, column_generation::Column &column)
+{
+    weight_limit.setUB(cap);
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        double master_value = duals.dominating[i];
+
+        for (auto &j : neighbors[i])
+        {
+            master_value += duals.edge[std::min(i, j)][std::max(i, j)];
+        }
+
+        objective.setLinearCoef(y[i], master_value);
+        objective.setLinearCoef(z[i], duals.dominating[i]);
+        objective.setLinearCoef(u[i], duals.dominated[i]);
+    }
+
+    optimal = cplex.solve() && cplex.getStatus() == IloAlgorithm::Optimal;
+
+    if (!cplex.isPrimalFeasible())
+    {
+        return -std::numeric_limits<double>::infinity();
+    }
+
+    column = column_generation::Column();
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        if (cplex.getValue(y[i]) > 0.5)
+        {
+            column.masters.push_back(i);
+        }
+
+        if (cplex.getValue(z[i]) > 0.5)
+        {
+            column.bridges.push_back(i);
+        }
+
+        for (auto &to : instance.adj_list_from_v[i])
+        {
+            if (cplex.getValue(x[i][to]) > 0.5)
+            {
+                column.arcs.push_back({i, to});
+                column.weight += instance.weight[i][to];
+            }
+        }
+    }
+
+    return cplex.getObjValue() + duals.trees;
+}
+
+/**
+ * @brief Set-partitioning formulation over tree columns (util_column_generation.h). The columns
+ * are generated by the pricing heuristics and, when they fail, by the exact pricing. For a cap C
+ * on the weight of the trees, a master LP with positive artificial cost proves that no solution
+ * has all trees lighter than C; otherwise the integer master over the generated columns gives a
+ * solution (price and branch). The cap is searched by bisection between the Lagrangian bound and
+ * the heuristic solution, and the identical sinks do not create symmetric solutions.
+ *
+ */
+class WSN_column_generation : public WSN
+{
+public:
+    WSN_column_generation(WSN_data &instance);
+    WSN_column_generation(WSN_data &instance, double upper_bound);
+
+    // searches the cap, with solve_relaxed only on the master LP (no integer master), which gives the bound of the column generation
+    virtual void solve(bool solve_relaxed = false);
+
+    // protected:
+    // the model is the master problem, built on solve
+    virtual void build_model();
+    virtual void add_objective_function();
+
+    // maximum number of columns of the pricing heuristics added on each iteration
+    int columns_by_iteration = 50;
+
+    // the master problem is not a compact model
+    virtual bool supports_model_options();
+
+private:
+    IloNumVarArray lambda;
+    IloNumVarArray slack;
+    IloRangeArray dominated_rows;
+    IloRangeArray dominating_rows;
+    IloRangeArray edge_rows;
+    IloRange trees_row;
+
+    std::vector<std::vector<int>> neighbors;
+    std::vector<std::vector<int>> edge_row_of; // row of the edge (i, neighbors[i][idx])
+
+    std::vector<column_generation::Column> columns;
+    std::set<column_generation::Column> pool;
+
+    void add_column(const column_generation::Column &column);
+    column_generation::Duals read_duals(IloCplex &cplex);
+
+    // start of the solve, the master LPs and the pricing share the time limit from it
+    std::chrono::high_resolution_clock::time_point solve_start;
+
+    // seconds left of the time limit
+    double time_left();
+
+    // solve the master LP for the cap, returns the value (artificial cost) and sets proven (false if the time ran out)
+    double generate_columns(IloCplex &cplex, TreePricing &pricing, double cap, bool &proven, int &iterations);
+};
+
+WSN_column_generation::WSN_column_generation(WSN_data &instance) : WSN(instance, "ColumnGeneration")
+{
+}
+
+WSN_column_generation::WSN_column_generation(WSN_data &instance, double upper_bound) : WSN(instance, "ColumnGeneration", upper_bound)
+{
+}
+
+bool WSN_column_generation::supports_model_options()
+{
+    return false;
+}
+
+void WSN_column_generation::build_model()
+{
+    int n = instance.n;
+
+    lambda = IloNumVarArray(env);
+    slack = IloNumVarArray(env, n + 1, 0, IloInfinity, ILOFLOAT);
+
+    dominated_rows = IloRangeArray(env);
+    dominating_rows = IloRangeArray(env);
+    edge_rows = IloRangeArray(env);
+
+    neighbors = column_generation::undirected_neighbors(instance);
+    edge_row_of = std::vector<std::vector<int>>(n);
+
+    for (int i = 0; i < n; i++)
+    {
+        dominated_rows.add(IloRange(env, 1, slack[i], IloInfinity));
+        dominating_rows.add(IloRange(env, -IloInfinity, 1));
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+        for (auto &j : neighbors[i])
+        {
+            if (j > i)
+            {
+                edge_row_of[i].push_back(edge_rows.getSize());
+                edge_rows.add(IloRange(env, -IloInfinity, 1));
+            }
+            else
+            {
+                // the row was created by j
+                auto idx = std::lower_bound(neighbors[j].begin(), neighbors[j].end(), i) - neighbors[j].begin();
+                edge_row_of[i].push_back(edge_row_of[j][idx]);
+            }
+        }
+    }
+
+    // the missing trees are also covered by an artificial variable
+    trees_row = IloRange(env, instance.number_trees, slack[n], instance.number_trees);
+
+    model.add(dominated_rows);
+    model.add(dominating_rows);
+    model.add(edge_rows);
+    model.add(trees_row);
+
+    add_objective_function();
+
+    // a tree for each master, always feasible for any cap
+    for (int m = 0; m < n; m++)
+    {
+        column_generation::Column column;
+        column.masters.push_back(m);
+
+        add_column(column);
+    }
+}
+
+void WSN_column_generation::add_objective_function()
+{
+    IloExpr expr(env);
+
+    for (int i = 0; i < slack.getSize(); i++)
+    {
+        expr += slack[i];
+    }
+
+    model.add(IloMinimize(env, expr));
+
+    expr.end();
+}
+
+void WSN_column_generation::add_column(const column_generation::Column &column)
+{
+    if (!pool.insert(column).second)
+    {
+        return;
+    }
+
+    IloNumVar var(env, 0, 1, ILOFLOAT);
+    var.setName(("lambda(" + std::to_string(columns.size()) + ")").c_str());
+
+    std::vector<bool> dominated(instance.n, false);
+
+    for (auto &m : column.masters)
+    {
+        dominated[m] = true;
+        for (auto &j : instance.adj_list_from_v[m])
+        {
+            dominated[j] = true;
+        }
+
+        dominating_rows[m].setLinearCoef(var, 1);
+
+        for (auto &row : edge_row_of[m])
+        {
+            edge_rows[row].setLinearCoef(var, 1);
+        }
+    }
+
+    for (auto &b : column.bridges)
+    {
+        dominating_rows[b].setLinearCoef(var, 1);
+    }
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        if (dominated[i])
+        {
+            dominated_rows[i].setLinearCoef(var, 1);
+        }
+    }
+
+    trees_row.setLinearCoef(var, 1);
+
+    lambda.add(var);
+    columns.push_back(column);
+}
+
+column_generation::Duals WSN_column_generation::read_duals(IloCplex &cplex)
+{
+    column_generation::Duals duals;
+
+    duals.dominated = std::vector<double>(instance.n);
+    duals.dominating = std::vector<double>(instance.n);
+    duals.edge = std::vector<std::vector<double>>(instance.n, std::vector<double>(instance.n, 0.0));
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        duals.dominated[i] = cplex.getDual(dominated_rows[i]);
+        duals.dominating[i] = cplex.getDual(dominating_rows[i]);
+
+        for (size_t idx = 0; idx < neighbors[i].size(); idx++)
+        {
+            int j = neighbors[i][idx];
+
+            if (j > i)
+            {
+                duals.edge[i][j] = cplex.getDual(edge_rows[edge_row_of[i][idx]]);
+            }
+        }
+    }
+
+    duals.trees = cplex.getDual(trees_row);
+
+    return duals;
+}
+
+double WSN_column_generation::time_left()
+{
+    return solver_params.time_limit - perf::time::duration(solve_start).count();
+}
+
+double WSN_column_generation::generate_columns(IloCplex &cplex, TreePricing &pricing, double cap, bool &proven, int &iterations)
+{
+    for (int t = 0; t < lambda.getSize(); t++)
+    {
+        lambda[t].setUB(columns[t].weight <= cap + 1e-9 ? 1 : 0);
+    }
+
+    proven = true;
+    double value = std::numeric_limits<double>::infinity();
+
+    while (true)
+    {
+        if (time_left() <= 0)
+        {
+            proven = false;
+            break;
+        }
+
+        iterations++;
+        cplex.setParam(IloCplex::Param::TimeLimit, time_left());
+
+        if (!cplex.solve() || cplex.getStatus() != IloAlgorithm::Optimal)
+        {
+            // no duals to price with, the cap is not decided
+            proven = false;
+            return std::numeric_limits<double>::infinity();
+        }
+
+        value = cplex.getObjValue();
+
+        auto duals = read_duals(cplex);
+        int before = lambda.getSize();
+
+        for (auto &column : column_generation::heuristic_pricing(instance, duals, cap))
+        {
+            add_column(column);
+
+            if (lambda.getSize() - before >= columns_by_iteration)
+            {
+                break;
+            }
+        }
+
+        if (lambda.getSize() > before)
+        {
+            continue;
+        }
+
+        if (time_left() <= 0)
+        {
+            proven = false;
+            break;
+        }
+
+        column_generation::Column column;
+        pricing.cplex.setParam(IloCplex::Param::TimeLimit, time_left());
+        double score = pricing.solve(duals, cap, column);
+
+        if (score > 1e-6)
+        {
+            add_column(column);
+        }
+
+        if (lambda.getSize() == before)
+        {
+            proven = pricing.optimal;
+            break;
+        }
+    }
+
+    return value;
+}
+
+void WSN_column_generation::solve(bool solve_relaxed)
+{
+    auto _name_model_instance = name_model_instance();
+    std::string time_now = print::time_now();
+
+    std::ofstream cplex_out((_name_model_instance + ".log").c_str());
+
+    auto start = perf::time::start();
+    solve_start = start;
+    phases.start(perf::Phase::Build);
+    build_model();
+    build_time = perf::time::duration(start).count();
+
+    // the heuristic solution is the first incumbent, and its trees are columns
+    WSNConstructiveHeuristic heur(instance);
+    auto sol = with_node_lists(heur.solve(0));
+
+    WSN_solution solution_checker(instance);
+    bool has_solution = solution_checker.is_valid(sol.edges, sol.masters, sol.bridges);
+
+    std::vector<column_generation::Column> best_columns;
+    double incumbent = std::numeric_limits<double>::infinity();
+
+    double total_weight = 0;
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (auto &j : instance.adj_list_from_v[i])
+        {
+            total_weight += instance.weight[i][j];
+        }
+    }
+
+    if (has_solution)
+    {
+        best_columns = column_generation::columns_of_solution(instance, sol.edges, sol.masters, sol.bridges);
+        incumbent = heur.weight_of_solution();
+
+        for (auto &column : best_columns)
+        {
+            add_column(column);
+        }
+    }
+
+    phases.start(perf::Phase::Solve);
+    double lower_bound = lagrangian::subgradient_optimization(instance, std::min({incumbent, upper_bound, total_weight})).bound;
+
+    phases.start(perf::Phase::Extract);
+    IloCplex cplex(model);
+    cplex.setOut(cplex_out);
+    cplex.setWarning(cplex_out);
+    cplex.setError(cplex_out);
+    set_params_cplex(cplex);
+
+    TreePricing pricing(instance, env);
+    pricing.cplex.setOut(cplex_out);
+    pricing.cplex.setWarning(cplex_out);
+    pricing.cplex.setError(cplex_out);
+    set_params_cplex(pricing.cplex);
+
+    phases.start(perf::Phase::Solve);
+    ProgressRecorder progress;
+    progress.add_sample(incumbent, lower_bound, 0);
+
+    int iterations = 0;
+
+    // caps below lo were proven infeasible or have no solution with the generated columns
+    double lo = lower_bound;
+
+    // smallest cap with a feasible master LP (only searched with solve_relaxed)
+    double lp_cap = std::numeric_limits<double>::infinity();
+
+    while (time_left() > 0)
+    {
+        double hi = std::min({has_solution ? incumbent : total_weight + 1, upper_bound, lp_cap});
+
+        if (hi - lo <= 1e-4 * std::max(1.0, hi))
+        {
+            break;
+        }
+
+        double cap = (lo + hi) / 2;
+        bool proven;
+
+        double artificial = generate_columns(cplex, pricing, cap, proven, iterations);
+
+        if (!proven && time_left() <= 0)
+        {
+            break;
+        }
+
+        if (artificial > 1e-6)
+        {
+            lo = cap;
+
+            if (proven)
+            {
+                lower_bound = cap;
+            }
+        }
+        else if (solve_relaxed)
+        {
+            lp_cap = cap;
+        }
+        else
+        {
+            // price and branch: integer master over the generated columns
+            IloConversion integer(env, lambda, ILOINT);
+            model.add(integer);
+
+            cplex.setParam(IloCplex::Param::TimeLimit, std::max(1.0, time_left()));
+
+            if (cplex.solve() && cplex.getObjValue() < 1e-6)
+            {
+                best_columns.clear();
+                incumbent = 0;
+
+                for (int t = 0; t < lambda.getSize(); t++)
+                {
+                    if (cplex.getValue(lambda[t]) > 0.5)
+                    {
+                        best_columns.push_back(columns[t]);
+                        incumbent = std::max(incumbent, columns[t].weight);
+                    }
+                }
+
+                has_solution = true;
+            }
+            else
+            {
+                lo = cap;
+            }
+
+            model.remove(integer);
+            integer.end();
+        }
+
+        progress.add_sample(incumbent, lower_bound, iterations);
+    }
+
+    progress.write(_name_model_instance + ".trajectory");
+
+    std::cout << "columns: " << columns.size() << " | master LPs: " << iterations << std::endl;
+
+    RunSummary run;
+
+    run.relaxed = solve_relaxed;
+    run.solve_time = perf::time::duration(start).count() - build_time;
+    run.best_bound = lower_bound;
+    run.nodes = iterations;
+    run.rows = cplex.getNrows();
+    run.cols = cplex.getNcols();
+    run.nonzeros = cplex.getNNZs();
+    run.status = has_solution ? "Bounded" : "Unknown";
+
+    std::vector<std::vector<int>> edges;
+    std::vector<int> masters;
+    std::vector<int> bridges;
+
+    for (auto &column : best_columns)
+    {
+        for (auto &[from, to] : column.arcs)
+        {
+            edges.push_back({from, to});
+        }
+
+        masters.insert(masters.end(), column.masters.begin(), column.masters.end());
+        bridges.insert(bridges.end(), column.bridges.begin(), column.bridges.end());
+    }
+
+    SolutionHeuristic best(edges, masters, bridges);
+
+    if (solve_relaxed)
+    {
+        // bound of the master LP, the caps between lower_bound and objective are not decided
+        run.objective = std::min(lp_cap, std::min(has_solution ? incumbent : total_weight + 1, upper_bound));
+        run.gap = (run.objective - lower_bound) / (1e-10 + std::abs(run.objective));
+        run.status = (run.gap <= 1e-4) ? "Optimal" : "Bounded";
+
+        write_results_without_solver(_name_model_instance, time_now, run, nullptr);
+    }
+    else
+    {
+        if (has_solution)
+        {
+            run.objective = incumbent;
+            run.gap = (incumbent - lower_bound) / (1e-10 + std::abs(incumbent));
+            run.status = (run.gap <= 1e-4) ? "Optimal" : "Bounded";
+        }
+
+        write_results_without_solver(_name_model_instance, time_now, run, has_solution ? &best : nullptr);
+    }
+
+    pricing.cplex.end();
+    cplex.end();
+}
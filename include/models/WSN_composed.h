@@ -0,0 +1,160 @@
+#pragma once
+
+#include "WSN.h"
+
+/**
+ * @brief Constraint families of the formulations. A family is a stateless builder with a static
+ * add(model) that builds its rows on the model (the loop is the add_* method of the class that
+ * owns its variables, so each family is built on a single place) and a sweep flag that is false
+ * when its rows depend on the number of trees. A formulation is a list of families on a base
+ * class, see WSN_composed.
+ *
+ */
+namespace family
+{
+    template <class... Families>
+    struct list
+    {
+    };
+
+    // rows that do not depend on the number of trees
+    struct Family
+    {
+        static constexpr bool sweep = true;
+    };
+
+    // rows that use the number of trees on the right-hand side, the model can't be swept
+    struct DependsOnTrees
+    {
+        static constexpr bool sweep = false;
+    };
+
+    struct DecisionVariables : Family
+    {
+        template <class Model>
+        static void add(Model &model) { model.add_decision_variables(); }
+    };
+
+    struct DominatingNodes : Family
+    {
+        template <class Model>
+        static void add(Model &model) { model.add_number_dominating_nodes_constraints(); }
+    };
+
+    struct ForestEdges : Family
+    {
+        template <class Model>
+        static void add(Model &model) { model.add_number_forest_edges_constraints(); }
+    };
+
+    struct InComingEdge : Family
+    {
+        template <class Model>
+        static void add(Model &model) { model.add_in_coming_edge_constraints(); }
+    };
+
+    struct NodeMasterOrBridge : Family
+    {
+        template <class Model>
+        static void add(Model &model) { model.add_node_master_or_bridge_constraints(); }
+    };
+
+    struct MasterNeighbor : Family
+    {
+        template <class Model>
+        static void add(Model &model) { model.add_master_neighbor_constraints(); }
+    };
+
+    struct MasterNotAdjMaster : Family
+    {
+        template <class Model>
+        static void add(Model &model) { model.add_master_not_adj_master_constraints(); }
+    };
+
+    struct BridgesNotNeighbor : Family
+    {
+        template <class Model>
+        static void add(Model &model) { model.add_bridges_not_neighbor_constraints(); }
+    };
+
+    struct BridgeMasterNeighbor : Family
+    {
+        template <class Model>
+        static void add(Model &model) { model.add_bridge_master_neighbor_constraints(); }
+    };
+
+    struct TrivialTree : Family
+    {
+        template <class Model>
+        static void add(Model &model) { model.add_trivial_tree_constraints(); }
+    };
+
+    struct UpperBound : Family
+    {
+        template <class Model>
+        static void add(Model &model) { model.add_upper_bound_constraint(); }
+    };
+
+    struct Objective : Family
+    {
+        template <class Model>
+        static void add(Model &model) { model.add_objective_function(); }
+    };
+} // namespace family
+
+/**
+ * @brief Formulation composed at compile time from a descriptor with the base class (the variables
+ * and the add_* methods of the families), the name and the list of families, built on the order
+ * of the list. A new variant is a new descriptor, e.g.
+ *
+ *     struct MyVariant
+ *     {
+ *         using base = WSN_flow_model_3_base;
+ *         static constexpr const char *name = "FlowModel3-my-variant";
+ *         using families = family::list<family::DecisionVariables, ..., family::Objective>;
+ *     };
+ *
+ *     register_model<WSN_composed<MyVariant>>(factories, "FlowModel3-my-variant");
+ *
+ * @tparam Formulation is the descriptor of the formulation
+ */
+template <class Formulation, class Families = typename Formulation::families>
+class WSN_composed;
+
+template <class Formulation, class... Families>
+class WSN_composed<Formulation, family::list<Families...>> : public Formulation::base
+{
+public:
+    WSN_composed(WSN_data &instance);
+    WSN_composed(WSN_data &instance, double upper_bound);
+
+    virtual void build_model() override;
+
+    // the base can be swept and none of the families depends on the number of trees
+    virtual bool supports_sweep() override;
+};
+
+template <class Formulation, class... Families>
+WSN_composed<Formulation, family::list<Families...>>::WSN_composed(WSN_data &instance) : Formulation::base(instance)
+{
+    WSN::formulation_name = Formulation::name;
+}
+
+template <class Formulation, class... Families>
+WSN_composed<Formulation, family::list<Families...>>::WSN_composed(WSN_data &instance,
+                                                                   double upper_bound) : Formulation::base(instance, upper_bound)
+{
+    WSN::formulation_name = Formulation::name;
+}
+
+template <class Formulation, class... Families>
+void WSN_composed<Formulation, family::list<Families...>>::build_model()
+{
+    (Families::add(*this), ...);
+}
+
+template <class Formulation, class... Families>
+bool WSN_composed<Formulation, family::list<Families...>>::supports_sweep()
+{
+    return Formulation::base::supports_sweep() && (Families::sweep && ...);
+}
@@ -160,6 +160,16 @@ void WSN_flow_model_2_1_base::add_flow_model_variables()
             }
         }
     }
+
+    // the arcs of the sink k are on the row n + k of z_depot[k]
+    std::vector<int> sink_row;
+
+    for (int k = 0; k < instance.number_trees; k++)
+    {
+        sink_row.push_back(instance.n + k);
+    }
+
+    set_per_sink_variables(z_depot, sink_row);
 }
 
 void WSN_flow_model_2_1_base::add_flow_limit_constraints()
@@ -195,8 +195,8 @@ void WSN_flow_model_2_1_sbc::add_remove_symmetries()
     //     }
     // }
 
-    // test_5
-    for (int k = 0; k < instance.number_trees; k++)
+    // test_5 (an order chosen with --symmetry replaces it, see WSN::add_symmetry_breaking)
+    for (int k = 0; k < instance.number_trees && symmetry == symmetry::Ordering::Formulation; k++)
     {
         for (int v = 0; v < instance.n; v++)
         {
@@ -1,109 +1,65 @@
 #pragma once
 
 #include "WSN_flow_model_3_base.h"
+#include "util_valid_inequalities_separator.h"
 
-class WSN_flow_model_3_testing_ineq : public WSN_flow_model_3_base
-{
-private:
-    virtual void build_model();
+#include <memory>
 
-public:
-    WSN_flow_model_3_testing_ineq(WSN_data &instance);
-    WSN_flow_model_3_testing_ineq(WSN_data &instance, double upper_bound);
-};
-
-WSN_flow_model_3_testing_ineq::WSN_flow_model_3_testing_ineq(WSN_data &instance) : WSN_flow_model_3_base(instance)
+struct FlowModel3TestingIneq
 {
-    WSN::formulation_name = "FlowModel3-testing-ineq";
-}
+    using base = WSN_flow_model_3_base;
+    static constexpr const char *name = "FlowModel3-testing-ineq";
+    using families = family::flow_model_3::with<family::flow_model_3::Adasme2023,
+                                                family::flow_model_3::CastroAndrade2023,
+                                                family::flow_model_3::RemoveSymmetries,
+                                                family::flow_model_3::LowerBoundWeight2Levels>;
+};
 
-WSN_flow_model_3_testing_ineq::WSN_flow_model_3_testing_ineq(WSN_data &instance,
-                                                             double upper_bound) : WSN_flow_model_3_base(instance, upper_bound)
+struct FlowModel3ValidIneq
 {
-    WSN::formulation_name = "FlowModel3-testing-ineq";
-}
+    using base = WSN_flow_model_3_base;
+    static constexpr const char *name = "FlowModel3-valid-ineq";
+    using families = family::flow_model_3::with<family::flow_model_3::Adasme2023,
+                                                family::flow_model_3::CastroAndrade2023,
+                                                family::flow_model_3::RemoveSymmetries>;
+};
 
-void WSN_flow_model_3_testing_ineq::build_model()
+// CastroAndrade2023 are separated on add_callbacks
+struct FlowModel3ValidIneqSep
 {
-    add_decision_variables();
-    add_flow_model_variables();
-
-    add_number_dominating_nodes_constraints(); // exp 3
-    add_number_forest_edges_constraints();     // exp 4
-    add_in_coming_edge_constraints();          // exp
-
-    add_master_not_adj_master_constraints();  // exp 11
-    add_node_master_or_bridge_constraints();  // exp 12
-    add_bridges_not_neighbor_constraints();   // exp 13
-    add_bridge_master_neighbor_constraints(); // exp 14
-    add_master_neighbor_constraints();        // exp 21
-    add_trivial_tree_constraints();
-    add_upper_bound_constraint();
-
-    add_flow_limit_constraints();        // exp 5, 7, 8
-    add_flow_conservation_constraints(); // exp 6
-    add_extra_node_constraints();        // exp 9, 10
-    add_lower_bound_constraints();       // exp 20
-    add_leaf_constraints();              // exp 22
-
-    // valid inequalities
-    add_adasme2023_valid_inequalities();
-    add_CastroAndrade2023_valid_inequalities();
-    add_remove_symmetries();
-    // add_testing_valid_inequalities();
-    add_lower_bound_weight_2_levels();
+    using base = WSN_flow_model_3_base;
+    static constexpr const char *name = "FlowModel3-valid-ineq-sep";
+    using families = family::flow_model_3::with<family::flow_model_3::Adasme2023,
+                                                family::flow_model_3::RemoveSymmetries>;
+};
 
-    add_objective_function();
-}
+using WSN_flow_model_3_testing_ineq = WSN_composed<FlowModel3TestingIneq>;
+using WSN_flow_model_3_valid_ineq = WSN_composed<FlowModel3ValidIneq>;
 
-class WSN_flow_model_3_valid_ineq : public WSN_flow_model_3_base
+/**
+ * @brief Same model as FlowModel3-valid-ineq, but the valid inequalities of CastroAndrade2023
+ * are separated on the relaxation (user cuts) instead of being added to the model.
+ *
+ */
+class WSN_flow_model_3_valid_ineq_sep : public WSN_composed<FlowModel3ValidIneqSep>
 {
 private:
-    virtual void build_model();
+    virtual void add_callbacks(CallbackDispatcher &callbacks);
+
+    std::shared_ptr<CastroAndrade2023Separator> separator;
 
 public:
-    WSN_flow_model_3_valid_ineq(WSN_data &instance);
-    WSN_flow_model_3_valid_ineq(WSN_data &instance, double upper_bound);
+    using WSN_composed<FlowModel3ValidIneqSep>::WSN_composed;
 };
 
-WSN_flow_model_3_valid_ineq::WSN_flow_model_3_valid_ineq(WSN_data &instance) : WSN_flow_model_3_base(instance)
+void WSN_flow_model_3_valid_ineq_sep::add_callbacks(CallbackDispatcher &callbacks)
 {
-    WSN::formulation_name = "FlowModel3-valid-ineq";
+    separator = std::make_shared<CastroAndrade2023Separator>(instance, x, y, z,
+                                                             std::vector<valid_inequalities::Family>({valid_inequalities::CastroAndrade2023_10,
+                                                                                                      valid_inequalities::CastroAndrade2023_12,
+                                                                                                      valid_inequalities::CastroAndrade2023_15,
+                                                                                                      valid_inequalities::CastroAndrade2023_16,
+                                                                                                      valid_inequalities::CastroAndrade2023_17}));
+
+    callbacks.add(separator.get(), IloCplex::Callback::Context::Id::Relaxation);
 }
-
-WSN_flow_model_3_valid_ineq::WSN_flow_model_3_valid_ineq(WSN_data &instance,
-                                                         double upper_bound) : WSN_flow_model_3_base(instance, upper_bound)
-{
-    WSN::formulation_name = "FlowModel3-valid-ineq";
-}
-
-void WSN_flow_model_3_valid_ineq::build_model()
-{
-    add_decision_variables();
-    add_flow_model_variables();
-
-    add_number_dominating_nodes_constraints(); // exp 3
-    add_number_forest_edges_constraints();     // exp 4
-    add_in_coming_edge_constraints();          // exp
-
-    add_master_not_adj_master_constraints();  // exp 11
-    add_node_master_or_bridge_constraints();  // exp 12
-    add_bridges_not_neighbor_constraints();   // exp 13
-    add_bridge_master_neighbor_constraints(); // exp 14
-    add_master_neighbor_constraints();        // exp 21
-    add_trivial_tree_constraints();
-    add_upper_bound_constraint();
-
-    add_flow_limit_constraints();        // exp 5, 7, 8
-    add_flow_conservation_constraints(); // exp 6
-    add_extra_node_constraints();        // exp 9, 10
-    add_lower_bound_constraints();       // exp 20
-    add_leaf_constraints();              // exp 22
-
-    // valid inequalities
-    add_adasme2023_valid_inequalities();
-    add_CastroAndrade2023_valid_inequalities();
-    add_remove_symmetries();
-
-    add_objective_function();
-}
\ No newline at end of file
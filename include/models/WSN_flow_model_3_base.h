@@ -1,6 +1,7 @@
 #pragma once
 
 #include "WSN.h"
+#include "WSN_composed.h"
 
 /**
  * @brief A flow-based model where the flow from a node i it is
@@ -20,6 +21,9 @@ public:
 
     double M;
 
+    IloRangeArray extra_node_constraints; // one arc leaves each sink (exp 9)
+    IloRangeArray flow_limit_constraints; // big-M limit of the flow on arcs (exp 8)
+
     virtual void add_objective_function();
 
     void add_flow_model_variables();
@@ -44,21 +48,29 @@ public:
 
     // calculates an big-M
     double calculates_big_M();
+    double calculates_big_M(int number_trees);
 
     virtual void print_full(IloCplex &cplex, std::ostream &cout = std::cout);
     virtual void set_params_cplex(IloCplex &cplex);
+
+    virtual bool supports_sweep();
+    virtual void set_active_trees(int number_of_trees);
 };
 
 WSN_flow_model_3_base::WSN_flow_model_3_base(WSN_data &instance) : WSN(instance, "FlowModel3-base"),
                                                                    f(IloArray<IloNumVarArray>(env, instance.n + instance.number_trees)),
-                                                                   M(calculates_big_M())
+                                                                   M(calculates_big_M()),
+                                                                   extra_node_constraints(IloRangeArray(env)),
+                                                                   flow_limit_constraints(IloRangeArray(env))
 {
 }
 
 WSN_flow_model_3_base::WSN_flow_model_3_base(WSN_data &instance,
                                              double upper_bound) : WSN(instance, "FlowModel3-base", upper_bound),
                                                                    f(IloArray<IloNumVarArray>(env, instance.n + instance.number_trees)),
-                                                                   M(calculates_big_M())
+                                                                   M(calculates_big_M()),
+                                                                   extra_node_constraints(IloRangeArray(env)),
+                                                                   flow_limit_constraints(IloRangeArray(env))
 {
 }
 
@@ -68,6 +80,49 @@ void WSN_flow_model_3_base::set_params_cplex(IloCplex &cplex)
     // cplex.setParam(IloCplex::Param::Benders::Strategy, 3);
 }
 
+bool WSN_flow_model_3_base::supports_sweep()
+{
+    return true;
+}
+
+void WSN_flow_model_3_base::set_active_trees(int number_of_trees)
+{
+    WSN::set_active_trees(number_of_trees);
+
+    // the flow of a tree is bounded by a weight that grows when the number of trees decreases
+    M = calculates_big_M(number_of_trees);
+
+    int built_trees = extra_node_constraints.getSize();
+    int idx = 0;
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (auto &to : instance.adj_list_from_v[i])
+        {
+            flow_limit_constraints[idx++].setLinearCoef(x[i][to], -M);
+        }
+
+        for (int k = 0; k < built_trees; k++)
+        {
+            flow_limit_constraints[idx++].setLinearCoef(x[instance.n + k][i], -M);
+        }
+    }
+
+    for (int i = 0; i < instance.n + built_trees; i++)
+    {
+        for (int j = 0; j < instance.n; j++)
+        {
+            f[i][j].setUB(M);
+        }
+    }
+
+    for (int k = 0; k < built_trees; k++)
+    {
+        int arcs_from_sink = (k < number_of_trees) ? 1 : 0;
+        extra_node_constraints[k].setBounds(arcs_from_sink, arcs_from_sink);
+    }
+}
+
 void WSN_flow_model_3_base::build_model()
 {
     add_decision_variables();
@@ -152,18 +207,20 @@ void WSN_flow_model_3_base::add_flow_limit_constraints()
         }
     }
 
-    // exp 8
+    // exp 8 (kept as ranges, so M can be changed on the built model)
     for (int i = 0; i < instance.n; i++)
     {
         for (auto &to : instance.adj_list_from_v[i])
         {
-            constraints.add(f[i][to] <= M * x[i][to]);
+            flow_limit_constraints.add(IloRange(env, -IloInfinity, f[i][to] - M * x[i][to], 0));
+            constraints.add(flow_limit_constraints[flow_limit_constraints.getSize() - 1]);
         }
 
         // arc from node r
         for (int k = 0; k < instance.number_trees; k++)
         {
-            constraints.add(f[instance.n + k][i] <= M * x[instance.n + k][i]);
+            flow_limit_constraints.add(IloRange(env, -IloInfinity, f[instance.n + k][i] - M * x[instance.n + k][i], 0));
+            constraints.add(flow_limit_constraints[flow_limit_constraints.getSize() - 1]);
         }
     }
 
@@ -216,7 +273,8 @@ void WSN_flow_model_3_base::add_extra_node_constraints()
             expr += x[instance.n + k][i];
         }
 
-        constraints.add(expr == 1);
+        extra_node_constraints.add(IloRange(env, 1, expr, 1));
+        constraints.add(extra_node_constraints[k]);
         expr.end();
         expr = IloExpr(env);
     }
@@ -422,6 +480,12 @@ inline void WSN_flow_model_3_base::add_lower_bound_weight_2_levels()
 
 void WSN_flow_model_3_base::add_remove_symmetries()
 {
+    // an order chosen with --symmetry replaces test_5 (see WSN::add_symmetry_breaking)
+    if (symmetry != symmetry::Ordering::Formulation)
+    {
+        return;
+    }
+
     // adapted from work of Robertty
     IloExpr expr(env);
 
@@ -454,6 +518,11 @@ void WSN_flow_model_3_base::add_remove_symmetries()
 }
 
 double WSN_flow_model_3_base::calculates_big_M()
+{
+    return calculates_big_M(instance.number_trees);
+}
+
+double WSN_flow_model_3_base::calculates_big_M(int number_trees)
 {
     double M_weight = 1.0;
     std::vector<double> weights;
@@ -468,7 +537,7 @@ double WSN_flow_model_3_base::calculates_big_M()
 
     std::sort(weights.begin(), weights.end(), std::greater<double>());
 
-    for (int i = 0; i < (instance.n - instance.number_trees) && i < weights.size(); i++)
+    for (int i = 0; i < (instance.n - number_trees) && i < weights.size(); i++)
     {
         M_weight += weights[i];
     }
@@ -509,4 +578,92 @@ void WSN_flow_model_3_base::print_full(IloCplex &cplex, std::ostream &cout)
 
         return std::pair<std::vector<std::vector<int>>, std::vector<double>>({vec, values});
     };
-}
\ No newline at end of file
+}
+
+namespace family
+{
+    // families of the variables and loops of WSN_flow_model_3_base
+    namespace flow_model_3
+    {
+        struct FlowVariables : Family
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_flow_model_variables(); }
+        };
+
+        // exp 5, 7, 8
+        struct FlowLimit : Family
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_flow_limit_constraints(); }
+        };
+
+        // exp 6
+        struct FlowConservation : Family
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_flow_conservation_constraints(); }
+        };
+
+        // exp 9, 10
+        struct ExtraNode : Family
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_extra_node_constraints(); }
+        };
+
+        // exp 20
+        struct LowerBound : Family
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_lower_bound_constraints(); }
+        };
+
+        // exp 22
+        struct Leaf : Family
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_leaf_constraints(); }
+        };
+
+        struct Adasme2023 : DependsOnTrees
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_adasme2023_valid_inequalities(); }
+        };
+
+        struct CastroAndrade2023 : DependsOnTrees
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_CastroAndrade2023_valid_inequalities(); }
+        };
+
+        struct Testing : DependsOnTrees
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_testing_valid_inequalities(); }
+        };
+
+        struct LowerBoundWeight2Levels : DependsOnTrees
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_lower_bound_weight_2_levels(); }
+        };
+
+        // test_5
+        struct RemoveSymmetries : DependsOnTrees
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_remove_symmetries(); }
+        };
+
+        // the model of WSN_flow_model_3_base::build_model, without the valid inequalities
+        template <class... ValidInequalities>
+        using with = list<DecisionVariables, FlowVariables,
+                          DominatingNodes, ForestEdges, InComingEdge,
+                          MasterNotAdjMaster, NodeMasterOrBridge, BridgesNotNeighbor, BridgeMasterNeighbor,
+                          MasterNeighbor, TrivialTree, UpperBound,
+                          FlowLimit, FlowConservation, ExtraNode, LowerBound, Leaf,
+                          ValidInequalities..., Objective>;
+    } // namespace flow_model_3
+} // namespace family
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "WSN.h"
+#include "util_lagrangian.h"
+
+/**
+ * @brief Bound given by the Lagrangian relaxation of the domination rows (see util_lagrangian.h),
+ * with the constructive heuristic as the primal solution. No compact model is built and cplex is
+ * not called, so it can be used on instances where even the root LP does not fit in memory.
+ *
+ */
+class WSN_lagrangian : public WSN
+{
+public:
+    WSN_lagrangian(WSN_data &instance);
+    WSN_lagrangian(WSN_data &instance, double upper_bound);
+
+    // computes the bound and the heuristic solution (solve_relaxed has no effect, the result is a bound)
+    virtual void solve(bool solve_relaxed = false);
+
+    int max_iterations = 1000;
+
+    // the bound does not solve a compact model
+    virtual bool supports_model_options();
+
+    // protected:
+    // the bound does not use a compact model
+    virtual void build_model();
+    virtual void add_objective_function();
+
+    // finite value used on the step size when there is no solution (no tree weighs more than all arcs)
+    double total_arc_weight();
+};
+
+WSN_lagrangian::WSN_lagrangian(WSN_data &instance) : WSN(instance, "Lagrangian")
+{
+}
+
+WSN_lagrangian::WSN_lagrangian(WSN_data &instance, double upper_bound) : WSN(instance, "Lagrangian", upper_bound)
+{
+}
+
+void WSN_lagrangian::build_model()
+{
+}
+
+bool WSN_lagrangian::supports_model_options()
+{
+    return false;
+}
+
+void WSN_lagrangian::add_objective_function()
+{
+}
+
+double WSN_lagrangian::total_arc_weight()
+{
+    double total = 0;
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (auto &j : instance.adj_list_from_v[i])
+        {
+            total += instance.weight[i][j];
+        }
+    }
+
+    return total;
+}
+
+void WSN_lagrangian::solve(bool solve_relaxed)
+{
+    auto _name_model_instance = name_model_instance();
+    std::string time_now = print::time_now();
+
+    auto start = perf::time::start();
+    phases.start(perf::Phase::Solve);
+
+    WSNConstructiveHeuristic heur(instance);
+    auto sol = with_node_lists(heur.solve(0));
+
+    WSN_solution solution_checker(instance);
+    bool has_solution = solution_checker.is_valid(sol.edges, sol.masters, sol.bridges);
+
+    double incumbent = has_solution ? heur.weight_of_solution() : std::numeric_limits<double>::infinity();
+    double target = std::min({incumbent, upper_bound, total_arc_weight()});
+
+    ProgressRecorder progress;
+
+    auto result = lagrangian::subgradient_optimization(instance, target, max_iterations, [&](int iteration, double bound)
+                                                       { progress.add_sample(incumbent, bound, iteration); });
+
+    progress.write(_name_model_instance + ".trajectory");
+
+    RunSummary run;
+
+    run.relaxed = solve_relaxed;
+    run.solve_time = perf::time::duration(start).count();
+    run.best_bound = result.bound;
+    run.nodes = result.iterations;
+    run.status = "Bounded";
+
+    if (has_solution)
+    {
+        run.objective = incumbent;
+        run.gap = (incumbent - result.bound) / (1e-10 + std::abs(incumbent));
+        run.status = (run.gap <= 1e-6) ? "Optimal" : "Bounded";
+    }
+
+    write_results_without_solver(_name_model_instance, time_now, run, has_solution ? &sol : nullptr);
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "WSN.h"
+#include "WSN_composed.h"
 
 class WSN_mcf_model_base : public WSN
 {
@@ -8,7 +9,7 @@ public:
     WSN_mcf_model_base(WSN_data &instance);
     WSN_mcf_model_base(WSN_data &instance, double upper_bound);
 
-protected:
+    // protected:
     virtual void build_model();
 
     IloArray<IloArray<IloNumVarArray>> x_sink; // arc-sink assignment
@@ -164,6 +165,9 @@ inline void WSN_mcf_model_base::add_flow_model_variables()
             }
         }
     }
+
+    // the arcs of the sinks are on the row n of x_sink[k]
+    set_per_sink_variables(x_sink, y_sink, z_sink, std::vector<int>(instance.number_trees, instance.n));
 }
 
 inline void WSN_mcf_model_base::add_ahani2019_mcf_constraints()
@@ -490,4 +494,55 @@ void WSN_mcf_model_base::print_full(IloCplex &cplex, std::ostream &cout)
     auto [y_sink_full, y_sink_values] = read_full_matrix(y_sink, cplex, 1);
 
     print_matrix(y_sink_full, y_sink_values, "y_sink", cout);
-}
\ No newline at end of file
+}
+
+namespace family
+{
+    // families of the variables and loops of WSN_mcf_model_base
+    namespace mcf
+    {
+        struct FlowVariables : DependsOnTrees
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_flow_model_variables(); }
+        };
+
+        struct Ahani2019 : DependsOnTrees
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_ahani2019_mcf_constraints(); }
+        };
+
+        struct ConnectSinkAssignment : DependsOnTrees
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_connect_sink_assignment_constraints(); }
+        };
+
+        struct CastroAndrade2023 : Family
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_CastroAndrade2023_valid_inequalities(); }
+        };
+
+        struct Adasme2023 : DependsOnTrees
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_adasme2023_valid_inequalities(); }
+        };
+
+        struct McfValid : DependsOnTrees
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_mcf_valid_inequalities(); }
+        };
+
+        // the model of WSN_mcf_model_base::build_model with the valid inequalities
+        template <class... ValidInequalities>
+        using with = list<DecisionVariables,
+                          DominatingNodes, ForestEdges, InComingEdge, NodeMasterOrBridge, MasterNeighbor,
+                          MasterNotAdjMaster, BridgesNotNeighbor, BridgeMasterNeighbor, UpperBound, TrivialTree,
+                          FlowVariables, Ahani2019, ConnectSinkAssignment,
+                          ValidInequalities..., Objective>;
+    } // namespace mcf
+} // namespace family
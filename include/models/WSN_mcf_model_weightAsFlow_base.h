@@ -175,6 +175,16 @@ inline void WSN_mcf_weight_model_base::add_flow_model_variables()
             }
         }
     }
+
+    // the arcs of the sink k are on the row n + k of x_sink[k]
+    std::vector<int> sink_row;
+
+    for (int k = 0; k < instance.number_trees; k++)
+    {
+        sink_row.push_back(instance.n + k);
+    }
+
+    set_per_sink_variables(x_sink, y_sink, z_sink, sink_row);
 }
 
 inline void WSN_mcf_weight_model_base::add_ahani2019_mcf_constraints()
@@ -412,39 +422,6 @@ inline void WSN_mcf_weight_model_base::add_mcf_valid_inequalities()
     }
 }
 
-inline void WSN_mcf_weight_model_base::add_remove_symmetries()
-{
-    // adapted from work of Robertty
-    IloExpr expr(env);
-
-    // test_5
-    for (int k = 0; k < instance.number_trees; k++)
-    {
-        for (int v = 0; v < instance.n; v++)
-        {
-            for (int s = 0; s < k; s++)
-            {
-                for (int u = v + 1; u < instance.n; u++)
-                {
-                    expr += x_sink[s][instance.n + s][u];
-                }
-
-                for (int j = k; j < instance.number_trees; j++)
-                {
-                    expr -= x_sink[j][instance.n + j][v];
-                }
-
-                constraints.add(expr >= 0); // test_5
-
-                expr.end();
-                expr = IloExpr(env);
-            }
-        }
-    }
-
-    expr.end();
-}
-
 inline void WSN_mcf_weight_model_base::add_conservation_inequalities_assignment()
 {
     // flow conservation of number of nodes and limits
@@ -478,6 +455,45 @@ inline void WSN_mcf_weight_model_base::add_conservation_inequalities_assignment(
     }
 }
 
+inline void WSN_mcf_weight_model_base::add_remove_symmetries()
+{
+    // an order chosen with --symmetry replaces test_5 (see WSN::add_symmetry_breaking)
+    if (symmetry != symmetry::Ordering::Formulation)
+    {
+        return;
+    }
+
+    // adapted from work of Robertty
+    IloExpr expr(env);
+
+    // test_5
+    for (int k = 0; k < instance.number_trees; k++)
+    {
+        for (int v = 0; v < instance.n; v++)
+        {
+            for (int s = 0; s < k; s++)
+            {
+                for (int u = v + 1; u < instance.n; u++)
+                {
+                    expr += x_sink[s][instance.n + s][u];
+                }
+
+                for (int j = k; j < instance.number_trees; j++)
+                {
+                    expr -= x_sink[j][instance.n + j][v];
+                }
+
+                constraints.add(expr >= 0); // test_5
+
+                expr.end();
+                expr = IloExpr(env);
+            }
+        }
+    }
+
+    expr.end();
+}
+
 inline IloModel WSN_mcf_weight_model_base::create_relaxed()
 {
     IloModel relaxed(WSN::create_relaxed());
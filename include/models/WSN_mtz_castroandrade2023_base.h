@@ -0,0 +1,472 @@
+#pragma once
+
+#include "WSN.h"
+#include "WSN_composed.h"
+#include "wsn_constructive_heur.h"
+
+class WSN_mtz_castro_andrade_2023_base : public WSN
+{
+    // Implementação do modelo do artigo CastroAndrade2023 da SBPO
+    // (the formulations are lists of families on this class, see family::mtz_castro::with)
+public:
+    WSN_mtz_castro_andrade_2023_base(WSN_data &instance);
+    WSN_mtz_castro_andrade_2023_base(WSN_data &instance, double upper_bound);
+
+    // protected:
+    virtual void add_objective_function();
+
+    IloArray<IloNumVarArray> w;
+    IloNumVarArray t;
+    IloNumVarArray pi;
+
+    int p;
+    double M;
+
+    void add_mtz_model_variables();
+
+    // MTZ subtour elimination constraints
+    void add_subtour_constraints();
+
+    void add_in_coming_edge_mtz_constraints();
+
+    // constraints to calculate the weight of trees
+    void add_calculate_weight_tree_constraints();
+
+    // lower bound to the weight of node
+    void add_lower_bound_weight_constraints();
+
+    // leaf constraints
+    void add_leaf_constraints();
+
+    void add_bektas2014_constraints();
+
+    void add_castrodeAndrade2023_constraints();
+
+    // calculates an big-M
+    double calculates_big_M();
+
+    // with bound_by_trees, 30 is bounded by -2K and 50 is not added (as on MTZ-castro2023)
+    void add_adasme2023_valid_inequalities(bool bound_by_trees = false);
+
+    virtual void set_params_cplex(IloCplex &cplex);
+};
+
+WSN_mtz_castro_andrade_2023_base::WSN_mtz_castro_andrade_2023_base(WSN_data &instance) : WSN(instance, "MTZ-castro2023-base"),
+                                                                                         w(IloArray<IloNumVarArray>(env, instance.n)),
+                                                                                         t(IloNumVarArray(env, instance.n, 0, IloInfinity, ILOFLOAT)),
+                                                                                         pi(IloNumVarArray(env, instance.n, 0, IloInfinity, ILOFLOAT)),
+                                                                                         p((instance.n - instance.number_trees + 1) / 2),
+                                                                                         M(calculates_big_M())
+{
+}
+
+WSN_mtz_castro_andrade_2023_base::WSN_mtz_castro_andrade_2023_base(WSN_data &instance,
+                                                                   double upper_bound) : WSN(instance, "MTZ-castro2023-base", upper_bound),
+                                                                                         w(IloArray<IloNumVarArray>(env, instance.n)),
+                                                                                         t(IloNumVarArray(env, instance.n, 0, IloInfinity, ILOFLOAT)),
+                                                                                         pi(IloNumVarArray(env, instance.n, 0, IloInfinity, ILOFLOAT)),
+                                                                                         p((instance.n - instance.number_trees + 1) / 2),
+                                                                                         M(calculates_big_M())
+{
+}
+
+void WSN_mtz_castro_andrade_2023_base::set_params_cplex(IloCplex &cplex)
+{
+    WSN::set_params_cplex(cplex);
+    // cplex.setParam(IloCplex::Param::Benders::Strategy, 3);
+}
+
+void WSN_mtz_castro_andrade_2023_base::add_objective_function()
+{
+    model.add(IloMinimize(env, T));
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        constraints.add(T >= t[i]);
+    }
+}
+
+void WSN_mtz_castro_andrade_2023_base::add_mtz_model_variables()
+{
+    T.setName("T");
+
+    // Naming variables
+    for (int i = 0; i < instance.n; i++)
+    {
+        pi[i].setName(("pi(" + std::to_string(i) + ")").c_str());
+        t[i].setName(("t(" + std::to_string(i) + ")").c_str());
+    }
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        w[i] = IloNumVarArray(env, instance.n, 0, IloInfinity, ILOFLOAT);
+
+        // Naming variables
+        for (int j = 0; j < instance.n; j++)
+        {
+            w[i][j].setName(("w(" + std::to_string(i) + ")(" + std::to_string(j) + ")").c_str());
+        }
+    }
+}
+
+void WSN_mtz_castro_andrade_2023_base::add_subtour_constraints()
+{
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (auto &j : instance.adj_list_from_v[i])
+        {
+            // strengthened MTZ subtour elimination constraints
+            constraints.add(pi[j] - pi[i] - p * x[i][j] - (p - 2) * x[j][i] >= 1 - p);
+        }
+    }
+}
+
+void WSN_mtz_castro_andrade_2023_base::add_in_coming_edge_mtz_constraints()
+{
+    // Constraints 4
+    IloExpr expr(env);
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (auto &from : instance.adj_list_to_v[i])
+        {
+            expr += x[from][i];
+        }
+
+        constraints.add(expr <= (y[i] + z[i]));
+
+        expr.end();
+        expr = IloExpr(env);
+    }
+
+    expr.end();
+}
+
+void WSN_mtz_castro_andrade_2023_base::add_calculate_weight_tree_constraints()
+{
+    IloExpr expr(env);
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (auto &j : instance.adj_list_from_v[i])
+        {
+            expr += w[i][j];
+
+            constraints.add(w[i][j] <= M * x[i][j]);                                                // constraints doc 12
+            constraints.add(t[j] + instance.weight[i][j] * x[i][j] + M * (1 - x[i][j]) >= w[i][j]); // constraints doc 13
+            constraints.add(t[j] + instance.weight[i][j] * x[i][j] - M * (1 - x[i][j]) <= w[i][j]); // constraints doc 14
+        }
+
+        constraints.add(t[i] <= M * (y[i] + z[i])); // constraints doc 11
+        constraints.add(t[i] == expr);              // constraints doc 15
+
+        expr.end();
+        expr = IloExpr(env);
+    }
+}
+
+void WSN_mtz_castro_andrade_2023_base::add_lower_bound_weight_constraints()
+{
+    IloExpr expr(env);
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (auto &j : instance.adj_list_from_v[i])
+        {
+            expr += instance.weight[i][j] * x[i][j];
+        }
+
+        constraints.add(t[i] >= expr); // constraints doc 16
+
+        expr.end();
+        expr = IloExpr(env);
+    }
+
+    expr.end();
+}
+
+void WSN_mtz_castro_andrade_2023_base::add_leaf_constraints()
+{
+    for (int i = 0; i < instance.n; i++)
+    {
+        if (instance.adj_list_to_v[i].size() == 1)
+        {
+            // constraint doc 17
+            constraints.add(z[i] == 0);
+        }
+    }
+}
+
+double WSN_mtz_castro_andrade_2023_base::calculates_big_M()
+{
+    double M_weight = 1.0;
+    std::vector<double> weights;
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (auto &j : instance.adj_list_from_v[i])
+        {
+            weights.push_back(instance.weight[i][j]);
+        }
+    }
+
+    std::sort(weights.begin(), weights.end(), std::greater<double>());
+
+    for (int i = 0; i < (instance.n - instance.number_trees) && i < weights.size(); i++)
+    {
+        M_weight += weights[i];
+    }
+
+    return M_weight;
+}
+
+void WSN_mtz_castro_andrade_2023_base::add_bektas2014_constraints()
+{
+    int n = instance.n;
+
+    // restricoes Bektas2014
+    add_bektas2014_inequalities(pi, n);
+}
+
+void WSN_mtz_castro_andrade_2023_base::add_castrodeAndrade2023_constraints()
+{
+
+    IloExpr expr(env);
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (auto &j : instance.adj_list_from_v[i])
+        {
+            expr += (x[i][j] + x[j][i]);
+
+            constraints.add((x[i][j] + x[j][i]) <= y[i] + z[i]); // constraints 15
+
+            constraints.add(x[i][j] <= z[i] + z[j]); // constraints 16
+            constraints.add(x[i][j] <= y[i] + y[j]); // constraints 17
+        }
+
+        constraints.add(2 * z[i] <= expr); // constraints 12
+
+        expr.end();
+        expr = IloExpr(env);
+    }
+
+    for (int u = 0; u < instance.n; u++)
+    {
+        std::set<int> neighbors(instance.adj_list_from_v[u]);
+        neighbors.insert(u); // neighbors = N[u]
+
+        expr -= (y[u] + z[u]);
+        for (auto &v : instance.adj_list_from_v[u])
+        {
+            expr += x[u][v];
+            expr -= (y[v] + z[v]);
+
+            for (auto &l : instance.adj_list_from_v[v])
+            {
+                if (neighbors.find(l) != neighbors.end())
+                {
+                    expr += x[v][l];
+                }
+            }
+        }
+
+        constraints.add(expr <= -1); // constraints 10
+
+        expr.end();
+        expr = IloExpr(env);
+    }
+
+    expr.end();
+
+    IloExpr exp_ad_28(env);
+    for (int i = 0; i < instance.n; i++)
+    {
+        exp_ad_28 += (y[i] - z[i]);
+    }
+
+    constraints.add(exp_ad_28 >= instance.number_trees); // constraint 18 (castroAndrade2023)
+
+    exp_ad_28.end();
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        if (p - instance.number_trees + 1 >= 0)
+        {
+            constraints.add(pi[i] + z[i] <= p - instance.number_trees + 1); // constraint 23 (castroAndrade2023)
+        }
+    }
+
+    // Contraints 29
+    IloExpr exp_ad_29(env);
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (auto &to : instance.adj_list_from_v[i])
+        {
+            exp_ad_29 += z[to];
+        }
+
+        constraints.add(exp_ad_29 <= y[i] + instance.adj_list_from_v[i].size() - 1); // constraint 19 (castroAndrade2023)
+
+        exp_ad_29.end();
+        exp_ad_29 = IloExpr(env);
+    }
+
+    exp_ad_29.end();
+
+    IloExpr exp_ad_32(env);
+    for (int i = 0; i < instance.n; i++)
+    {
+        // Constraints 31
+        constraints.add(pi[i] >= z[i]); // constraint 20 (castroAndrade2023)
+
+        for (auto &from : instance.adj_list_to_v[i])
+        {
+            exp_ad_32 += x[from][i];
+        }
+
+        // Constraints 32
+        constraints.add(pi[i] >= 2 * exp_ad_32 - z[i]); // constraint 21 (castroAndrade2023)
+
+        exp_ad_32.end();
+        exp_ad_32 = IloExpr(env);
+    }
+
+    exp_ad_32.end();
+
+    IloExpr exp_ad_33(env);
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (auto &from : instance.adj_list_to_v[i])
+        {
+            for (auto &k : instance.adj_list_to_v[from])
+            {
+                exp_ad_33 += x[k][from];
+            }
+
+            // Constraints 33
+            constraints.add(pi[i] >= 2 * exp_ad_33 + (y[from] + z[i] - 1) - 2 * (1 - x[from][i])); // constraint 22 (castroAndrade2023)
+
+            exp_ad_33.end();
+            exp_ad_33 = IloExpr(env);
+        }
+    }
+
+    exp_ad_33.end();
+}
+
+inline void WSN_mtz_castro_andrade_2023_base::add_adasme2023_valid_inequalities(bool bound_by_trees)
+{
+    // constraints Adasme2023
+    for (int i = 0; i < instance.n; i++)
+    {
+        if (instance.adj_list_to_v[i].size() == 1)
+        {
+            for (auto &from : instance.adj_list_to_v[i])
+            {
+                // constraint 21
+                constraints.add(2 * (x[from][i] + x[i][from]) <= y[i] + z[from]);
+            }
+        }
+    }
+
+    for (int i = 0; i < instance.n && !bound_by_trees; i++)
+    {
+        // Constraints 50
+        constraints.add(x[instance.n][i] <= y[i]);
+    }
+
+    // Contraints 30
+    IloExpr exp_ad_30(env);
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        exp_ad_30 += (pi[i] - z[i] - 2 * y[i]);
+    }
+
+    constraints.add(exp_ad_30 >= (bound_by_trees ? -2 * instance.number_trees : -2)); // TODO check the bound of MTZ-castro2023
+    exp_ad_30.end();
+}
+
+namespace family
+{
+    // families of the variables and loops of WSN_mtz_castro_andrade_2023_base (numbers of CastroAndrade2023)
+    namespace mtz_castro
+    {
+        struct MtzVariables : Family
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_mtz_model_variables(); }
+        };
+
+        // 3
+        struct InComingEdgeMtz : Family
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_in_coming_edge_mtz_constraints(); }
+        };
+
+        // 2
+        struct Subtour : Family
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_subtour_constraints(); }
+        };
+
+        // pag. 5
+        struct CalculateWeightTree : Family
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_calculate_weight_tree_constraints(); }
+        };
+
+        // 25
+        struct LowerBoundWeight : Family
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_lower_bound_weight_constraints(); }
+        };
+
+        // 13
+        struct Leaf : Family
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_leaf_constraints(); }
+        };
+
+        // 12, 15, 16, 17, 10, 18, 19, 20, 21, 22, 23
+        struct CastrodeAndrade2023 : DependsOnTrees
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_castrodeAndrade2023_constraints(); }
+        };
+
+        struct Adasme2023 : DependsOnTrees
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_adasme2023_valid_inequalities(); }
+        };
+
+        // with 30 bounded by the number of trees and without 50
+        struct Adasme2023Trees : DependsOnTrees
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_adasme2023_valid_inequalities(true); }
+        };
+
+        struct Bektas2014 : Family
+        {
+            template <class Model>
+            static void add(Model &model) { model.add_bektas2014_constraints(); }
+        };
+
+        // the model of CastroAndrade2023 (SBPO) with the valid inequalities
+        template <class... ValidInequalities>
+        using with = list<DecisionVariables,
+                          DominatingNodes, ForestEdges, NodeMasterOrBridge, MasterNeighbor, MasterNotAdjMaster,
+                          BridgesNotNeighbor, BridgeMasterNeighbor, UpperBound,
+                          InComingEdgeMtz, MtzVariables, Subtour,
+                          CalculateWeightTree, LowerBoundWeight, Leaf, TrivialTree,
+                          CastrodeAndrade2023, ValidInequalities..., Objective>;
+    } // namespace mtz_castro
+} // namespace family
@@ -265,25 +265,7 @@ void WSN_mtz_model_2_1::add_bektas2014_constraints()
     int n = instance.n;
 
     // restricoes Bektas2014
-    for (int i = 0; i < instance.n; i++)
-    {
-        for (int j = 0; j < instance.n; j++)
-        {
-            for (int k = 0; k < instance.n; k++)
-            {
-                if ((instance.is_connected[i][j] == 1) & (instance.is_connected[j][k] == 1) & (instance.is_connected[i][k] == 1))
-                {
-                    // 3.1
-                    constraints.add(pi[i] - pi[k] - (n - 1) * (x[i][j] + x[j][k]) + (n - 3) * (x[k][j] + x[j][i]) + n * x[i][k] + (n - 4) * x[k][i] <= 2 * n - 4);
-                    // // 3.5 e 3.6
-                    constraints.add(pi[i] - pi[k] - (2 * n - 3) * x[i][k] + (n - 4) * x[k][i] + (n - 1) * (x[i][j] + x[j][k]) <= 2 * n - 4);
-                    constraints.add(pi[k] - pi[i] - (2 * n - 7) * x[i][k] + (n - 1) * x[k][i] + (n - 4) * (x[i][j] + x[j][k]) <= 2 * n - 6);
-                    // // 4.3
-                    constraints.add((3 * n - 7) * (x[i][k] + x[k][i]) + (n - 1) * (x[i][j] + x[j][k] + x[k][j] + x[j][i]) <= 4 * n - 8);
-                }
-            }
-        }
-    }
+    add_bektas2014_inequalities(pi, n);
 }
 
 void WSN_mtz_model_2_1::add_castrodeAndrade2023_constraints()
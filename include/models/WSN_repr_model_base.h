@@ -188,6 +188,16 @@ inline void WSN_representante_model_base::add_repr_model_variables()
             z_sink[k][i].setName(("z_sink(" + std::to_string(k) + ")(" + std::to_string(i) + ")").c_str());
         }
     }
+
+    // the representative u has no arcs of a sink and variables on the nodes v >= u only
+    std::vector<int> first_node;
+
+    for (int u = 0; u < instance.n; u++)
+    {
+        first_node.push_back(u);
+    }
+
+    set_per_sink_variables(x_sink, y_sink, z_sink, std::vector<int>(instance.n, -1), first_node);
 }
 
 void WSN_representante_model_base::add_mtz_model_variables()
@@ -286,25 +296,7 @@ void WSN_representante_model_base::add_mtz_bektas2014_inequalities()
 {
     int n = instance.n;
     // restricoes Bektas2014
-    for (int i = 0; i < instance.n; i++)
-    {
-        for (int j = 0; j < instance.n; j++)
-        {
-            for (int k = 0; k < instance.n; k++)
-            {
-                if ((instance.is_connected[i][j] == 1) & (instance.is_connected[j][k] == 1) & (instance.is_connected[i][k] == 1))
-                {
-                    // 3.1
-                    constraints.add(pi[i] - pi[k] - (n - 1) * (x[i][j] + x[j][k]) + (n - 3) * (x[k][j] + x[j][i]) + n * x[i][k] + (n - 4) * x[k][i] <= 2 * n - 4);
-                    // // 3.5 e 3.6
-                    constraints.add(pi[i] - pi[k] - (2 * n - 3) * x[i][k] + (n - 4) * x[k][i] + (n - 1) * (x[i][j] + x[j][k]) <= 2 * n - 4);
-                    constraints.add(pi[k] - pi[i] - (2 * n - 7) * x[i][k] + (n - 1) * x[k][i] + (n - 4) * (x[i][j] + x[j][k]) <= 2 * n - 6);
-                    // // 4.3
-                    constraints.add((3 * n - 7) * (x[i][k] + x[k][i]) + (n - 1) * (x[i][j] + x[j][k] + x[k][j] + x[j][i]) <= 4 * n - 8);
-                }
-            }
-        }
-    }
+    add_bektas2014_inequalities(pi, n);
 }
 
 inline void WSN_representante_model_base::add_connect_sink_assignment_constraints()
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include "wsn_data.h"
+
+/**
+ * @brief Values of the arcs between nodes (e.g. a point of the variables x of a callback), stored
+ * per arc in the order of the adjacency lists of the instance, so they take O(n + m) memory instead
+ * of a n x n matrix. The arcs of a node are visited by position: at(i, p) is the value of the arc
+ * from i to head(i, p), its p-th neighbor, and reverse(i, p) is the position of the opposite arc.
+ *
+ */
+class ArcValues
+{
+public:
+    ArcValues(WSN_data &instance);
+
+    // number of arcs from i
+    int degree(int i) const;
+
+    // p-th neighbor of i
+    int head(int i, int p) const;
+
+    // value of the arc from i to its p-th neighbor
+    double &at(int i, int p);
+    double at(int i, int p) const;
+
+    // position of the arc (head(i, p), i) on the list of head(i, p), -1 if there is no such arc
+    int reverse(int i, int p) const;
+
+    // position of j on the list of i, -1 if there is no arc (i, j)
+    int position(int i, int j) const;
+
+    // value of the arc (i, j), 0 if there is no arc
+    double operator()(int i, int j) const;
+
+    // set the value of the arc (i, j), which must exist
+    void set(int i, int j, double value);
+
+private:
+    std::vector<std::vector<int>> heads;
+    std::vector<std::vector<int>> reverse_position;
+    std::vector<std::vector<double>> values;
+};
+
+inline ArcValues::ArcValues(WSN_data &instance) : heads(instance.n), reverse_position(instance.n), values(instance.n)
+{
+    for (int i = 0; i < instance.n; i++)
+    {
+        heads[i].assign(instance.adj_list_from_v[i].begin(), instance.adj_list_from_v[i].end());
+        values[i].assign(heads[i].size(), 0.0);
+    }
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        reverse_position[i].resize(heads[i].size());
+
+        for (int p = 0; p < degree(i); p++)
+        {
+            reverse_position[i][p] = position(heads[i][p], i);
+        }
+    }
+}
+
+inline int ArcValues::degree(int i) const
+{
+    return heads[i].size();
+}
+
+inline int ArcValues::head(int i, int p) const
+{
+    return heads[i][p];
+}
+
+inline double &ArcValues::at(int i, int p)
+{
+    return values[i][p];
+}
+
+inline double ArcValues::at(int i, int p) const
+{
+    return values[i][p];
+}
+
+inline int ArcValues::reverse(int i, int p) const
+{
+    return reverse_position[i][p];
+}
+
+inline int ArcValues::position(int i, int j) const
+{
+    auto found = std::lower_bound(heads[i].begin(), heads[i].end(), j);
+
+    if (found == heads[i].end() || *found != j)
+    {
+        return -1;
+    }
+
+    return found - heads[i].begin();
+}
+
+inline double ArcValues::operator()(int i, int j) const
+{
+    int p = position(i, j);
+
+    return p < 0 ? 0.0 : values[i][p];
+}
+
+inline void ArcValues::set(int i, int j, double value)
+{
+    values[i][position(i, j)] = value;
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+
+#include "wsn_data.h"
+#include "util_connectivity.h"
+
+/**
+ * @brief Subproblem of the Benders decomposition: given the arcs and the sink assignment of an
+ * integer master solution, find the trees and their weights (the work done by the flow variables
+ * of the compact models) by a traversal from the sinks, in O(n + m).
+ *
+ * For a tree with arcs A and weight W, rooted at its master connected to the sink, the cut
+ *
+ * T >= W - sum over a in A of c(a) (1 - x(a)),   c(a) = w(a) + weight of the subtree below a
+ *
+ * is valid: the selected arcs of A that are still connected to the root are in the same tree, and
+ * removing the arcs a not selected removes at most c(a) from its weight.
+ */
+namespace benders
+{
+    struct Tree
+    {
+        int root;                              // node connected to the sink
+        double weight = 0;                     // sum of the weights of the arcs
+        std::vector<std::pair<int, int>> arcs; // arcs (from, to) of the tree
+        std::vector<double> coefficient;       // c(a) of each arc on the optimality cut
+    };
+
+    struct Subproblem
+    {
+        std::vector<Tree> trees;
+        std::vector<std::vector<int>> subtours; // components not connected to a sink (feasibility cuts)
+    };
+
+    /**
+     * @brief Find the trees of an integer solution and the subtours that make it infeasible
+     *
+     * @param instance is the problem instance
+     * @param arc_value is the value of x(i)(j) for the arcs between nodes
+     * @param sink_value is the sum of the arcs from the sinks to each node
+     * @return Subproblem with the trees and the subtours
+     */
+    inline Subproblem solve_subproblem(WSN_data &instance,
+                                const ArcValues &arc_value,
+                                const std::vector<double> &sink_value)
+    {
+        Subproblem subproblem;
+
+        subproblem.subtours = connectivity::find_subtours(instance, arc_value, sink_value);
+
+        std::vector<std::vector<int>> children(instance.n);
+
+        for (int i = 0; i < instance.n; i++)
+        {
+            for (int p = 0; p < arc_value.degree(i); p++)
+            {
+                if (arc_value.at(i, p) > 0.5)
+                {
+                    children[i].push_back(arc_value.head(i, p));
+                }
+            }
+        }
+
+        // weight of the subtree below each node
+        std::vector<double> below(instance.n, 0.0);
+        std::vector<bool> visited(instance.n, false);
+
+        for (int root = 0; root < instance.n; root++)
+        {
+            if (sink_value[root] < 0.5)
+            {
+                continue;
+            }
+
+            // preorder, the subtrees are accumulated on the reverse order
+            std::vector<int> order;
+            std::vector<int> stack({root});
+            visited[root] = true;
+
+            while (!stack.empty())
+            {
+                int v = stack.back();
+                stack.pop_back();
+                order.push_back(v);
+
+                for (auto &c : children[v])
+                {
+                    if (!visited[c])
+                    {
+                        visited[c] = true;
+                        stack.push_back(c);
+                    }
+                }
+            }
+
+            Tree tree;
+            tree.root = root;
+
+            for (auto v = order.rbegin(); v != order.rend(); v++)
+            {
+                for (auto &c : children[*v])
+                {
+                    below[*v] += instance.weight[*v][c] + below[c];
+
+                    tree.arcs.push_back({*v, c});
+                    tree.coefficient.push_back(instance.weight[*v][c] + below[c]);
+                }
+            }
+
+            tree.weight = below[root];
+
+            subproblem.trees.push_back(tree);
+        }
+
+        return subproblem;
+    }
+
+    /**
+     * @brief Value of the right-hand side of the optimality cut of a tree on a solution
+     *
+     * @param tree is the tree that defines the cut
+     * @param arc_value is the value of x(i)(j) for the arcs between nodes
+     * @return double is W - sum of c(a) (1 - x(a))
+     */
+    inline double optimality_cut_value(const Tree &tree, const ArcValues &arc_value)
+    {
+        double value = tree.weight;
+
+        for (size_t a = 0; a < tree.arcs.size(); a++)
+        {
+            auto [i, j] = tree.arcs[a];
+
+            value -= tree.coefficient[a] * (1 - arc_value(i, j));
+        }
+
+        return value;
+    }
+} // namespace benders
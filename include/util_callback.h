@@ -0,0 +1,59 @@
+#pragma once
+
+#include <ilcplex/ilocplex.h>
+
+#include <vector>
+#include <utility>
+
+/**
+ * @brief Cplex accepts a single generic callback, so this one forwards each context
+ * to the callbacks that were registered for it (e.g. progress recorder and cut separators).
+ *
+ */
+class CallbackDispatcher : public IloCplex::Callback::Function
+{
+public:
+    /**
+     * @brief Register a callback
+     *
+     * @param callback is the callback, it must live until the end of the solve
+     * @param contexts is the mask of IloCplex::Callback::Context::Id where it is invoked
+     */
+    void add(IloCplex::Callback::Function *callback, CPXLONG contexts);
+
+    // union of the contexts of all registered callbacks
+    CPXLONG contexts();
+
+    void invoke(const IloCplex::Callback::Context &context) override;
+
+private:
+    std::vector<std::pair<IloCplex::Callback::Function *, CPXLONG>> callbacks;
+};
+
+inline void CallbackDispatcher::add(IloCplex::Callback::Function *callback, CPXLONG contexts)
+{
+    callbacks.push_back({callback, contexts});
+}
+
+inline CPXLONG CallbackDispatcher::contexts()
+{
+    CPXLONG mask = 0;
+
+    for (auto &[callback, contexts] : callbacks)
+    {
+        mask |= contexts;
+    }
+
+    return mask;
+}
+
+inline void CallbackDispatcher::invoke(const IloCplex::Callback::Context &context)
+{
+    for (auto &[callback, contexts] : callbacks)
+    {
+        if (contexts & context.getId())
+        {
+            callback->invoke(context);
+        }
+    }
+}
@@ -0,0 +1,331 @@
+#pragma once
+
+#include <vector>
+#include <set>
+#include <utility>
+#include <tuple>
+#include <algorithm>
+
+#include "wsn_data.h"
+#include "util_connectivity.h"
+
+/**
+ * @brief Columns (trees) of the set-partitioning formulation and the pricing heuristics.
+ *
+ * For a cap C on the weight of the trees, the master problem chooses K trees with weight at most C
+ * such that the dominating nodes of the trees are disjoint, every node is dominated by a master and
+ * no edge joins masters (of the same or of different trees). The score of a column on the duals of
+ * these rows is its negative reduced cost, so the columns with positive score improve the master.
+ */
+namespace column_generation
+{
+    struct Column
+    {
+        std::vector<int> masters;
+        std::vector<int> bridges;
+        std::vector<std::pair<int, int>> arcs; // arcs (from, to), directed from the root master
+        double weight = 0;
+
+        bool operator<(const Column &other) const
+        {
+            return std::tie(masters, bridges, arcs) < std::tie(other.masters, other.bridges, other.arcs);
+        }
+    };
+
+    struct Duals
+    {
+        std::vector<double> dominated;              // every node is dominated (>= 1)
+        std::vector<double> dominating;             // a node is in at most one tree (<= 1)
+        std::vector<std::vector<double>> edge;      // masters not adjacent, edge[i][j] for i < j (<= 1)
+        double trees = 0;                           // number of trees (= K)
+    };
+
+    /**
+     * @brief Neighbors of each node on the undirected graph (an edge exists if any of the arcs exists)
+     *
+     * @param instance is the problem instance
+     * @return std::vector<std::vector<int>> with the sorted neighbors of each node
+     */
+    inline std::vector<std::vector<int>> undirected_neighbors(WSN_data &instance)
+    {
+        std::vector<std::vector<int>> neighbors(instance.n);
+
+        for (int i = 0; i < instance.n; i++)
+        {
+            std::set<int> adjacent(instance.adj_list_from_v[i]);
+            adjacent.insert(instance.adj_list_to_v[i].begin(), instance.adj_list_to_v[i].end());
+
+            neighbors[i] = std::vector<int>(adjacent.begin(), adjacent.end());
+        }
+
+        return neighbors;
+    }
+
+    /**
+     * @brief Score of a column: sum of the duals of the rows where it appears
+     *
+     * @param instance is the problem instance
+     * @param duals are the duals of the master problem
+     * @param column is the evaluated column
+     * @return double is the score (the column improves the master if it is positive)
+     */
+    inline double score(WSN_data &instance, const Duals &duals, const Column &column)
+    {
+        double value = duals.trees;
+        std::vector<bool> dominated(instance.n, false);
+
+        for (auto &m : column.masters)
+        {
+            dominated[m] = true;
+            for (auto &j : instance.adj_list_from_v[m])
+            {
+                dominated[j] = true;
+            }
+
+            for (int j = 0; j < instance.n; j++)
+            {
+                value += duals.edge[std::min(m, j)][std::max(m, j)];
+            }
+
+            value += duals.dominating[m];
+        }
+
+        for (auto &b : column.bridges)
+        {
+            value += duals.dominating[b];
+        }
+
+        for (int i = 0; i < instance.n; i++)
+        {
+            if (dominated[i])
+            {
+                value += duals.dominated[i];
+            }
+        }
+
+        return value;
+    }
+
+    /**
+     * @brief Split a solution (forest) in its trees
+     *
+     * @param instance is the problem instance
+     * @param edges are the arcs {from, to} of the forest
+     * @param masters are the master nodes
+     * @param bridges are the bridge nodes
+     * @return std::vector<Column> with one column by tree
+     */
+    inline std::vector<Column> columns_of_solution(WSN_data &instance, std::vector<std::vector<int>> &edges,
+                                            std::vector<int> &masters, std::vector<int> &bridges)
+    {
+        connectivity::UnionFind trees(instance.n);
+
+        for (auto &edge : edges)
+        {
+            trees.unite(edge[0], edge[1]);
+        }
+
+        std::vector<int> column_of_tree(instance.n, -1);
+        std::vector<Column> columns;
+
+        auto column_of = [&](int node) -> Column &
+        {
+            int root = trees.find(node);
+
+            if (column_of_tree[root] < 0)
+            {
+                column_of_tree[root] = columns.size();
+                columns.push_back(Column());
+            }
+
+            return columns[column_of_tree[root]];
+        };
+
+        for (auto &m : masters)
+        {
+            column_of(m).masters.push_back(m);
+        }
+
+        for (auto &b : bridges)
+        {
+            column_of(b).bridges.push_back(b);
+        }
+
+        for (auto &edge : edges)
+        {
+            auto &column = column_of(edge[0]);
+
+            column.arcs.push_back({edge[0], edge[1]});
+            column.weight += instance.weight[edge[0]][edge[1]];
+        }
+
+        for (auto &column : columns)
+        {
+            std::sort(column.masters.begin(), column.masters.end());
+            std::sort(column.bridges.begin(), column.bridges.end());
+            std::sort(column.arcs.begin(), column.arcs.end());
+        }
+
+        return columns;
+    }
+
+    /**
+     * @brief Columns with positive score found by fast heuristics: trees with a single master, and
+     * trees with a single bridge whose masters are chosen greedily by their marginal score
+     *
+     * @param instance is the problem instance
+     * @param duals are the duals of the master problem
+     * @param cap is the maximum weight of a column
+     * @param tolerance is the minimum score of a returned column
+     * @return std::vector<Column> with the columns sorted by decreasing score
+     */
+    inline std::vector<Column> heuristic_pricing(WSN_data &instance, const Duals &duals, double cap, double tolerance = 1e-6)
+    {
+        auto neighbors = undirected_neighbors(instance);
+
+        // score of a node as a master, apart from the nodes it dominates
+        std::vector<double> master_value(instance.n, 0.0);
+
+        for (int m = 0; m < instance.n; m++)
+        {
+            master_value[m] = duals.dominating[m];
+
+            for (auto &j : neighbors[m])
+            {
+                master_value[m] += duals.edge[std::min(m, j)][std::max(m, j)];
+            }
+        }
+
+        std::vector<int> times_dominated(instance.n, 0);
+
+        // score of the nodes dominated by m that are not dominated yet
+        auto new_dominated = [&](int m)
+        {
+            double value = (times_dominated[m] == 0) ? duals.dominated[m] : 0;
+
+            for (auto &j : instance.adj_list_from_v[m])
+            {
+                value += (times_dominated[j] == 0) ? duals.dominated[j] : 0;
+            }
+
+            return value;
+        };
+
+        auto dominate = [&](int m, int change)
+        {
+            times_dominated[m] += change;
+
+            for (auto &j : instance.adj_list_from_v[m])
+            {
+                times_dominated[j] += change;
+            }
+        };
+
+        std::vector<std::pair<double, Column>> found;
+
+        // a single master
+        for (int m = 0; m < instance.n; m++)
+        {
+            double value = duals.trees + master_value[m] + new_dominated(m);
+
+            if (value > tolerance)
+            {
+                Column column;
+                column.masters.push_back(m);
+
+                found.push_back({value, column});
+            }
+        }
+
+        // a single bridge b, the root master r -> b and b -> m for the other masters
+        for (int b = 0; b < instance.n; b++)
+        {
+            std::vector<int> chosen;
+            std::vector<bool> blocked(instance.n, false); // chosen or adjacent to a chosen master
+            double value = duals.trees + duals.dominating[b];
+            double weight = 0;
+
+            while (true)
+            {
+                int best = -1;
+                double best_gain = 0;
+
+                for (auto &m : neighbors[b])
+                {
+                    bool has_arc = chosen.empty() ? instance.is_connected[m][b] == 1 : instance.is_connected[b][m] == 1;
+                    double arc_weight = chosen.empty() ? instance.weight[m][b] : instance.weight[b][m];
+
+                    if (blocked[m] || !has_arc || weight + arc_weight > cap)
+                    {
+                        continue;
+                    }
+
+                    double gain = master_value[m] + new_dominated(m);
+
+                    // the bridge needs two masters, so the first two are taken even without gain
+                    if (best < 0 || gain > best_gain)
+                    {
+                        if (chosen.size() < 2 || gain > tolerance)
+                        {
+                            best = m;
+                            best_gain = gain;
+                        }
+                    }
+                }
+
+                if (best < 0)
+                {
+                    break;
+                }
+
+                weight += chosen.empty() ? instance.weight[best][b] : instance.weight[b][best];
+                value += best_gain;
+                chosen.push_back(best);
+                dominate(best, 1);
+
+                blocked[best] = true;
+                for (auto &j : neighbors[best])
+                {
+                    blocked[j] = true;
+                }
+            }
+
+            for (auto &m : chosen)
+            {
+                dominate(m, -1);
+            }
+
+            if (chosen.size() < 2 || value <= tolerance)
+            {
+                continue;
+            }
+
+            Column column;
+            column.masters = chosen;
+            column.bridges.push_back(b);
+            column.weight = weight;
+
+            column.arcs.push_back({chosen.front(), b});
+            for (size_t i = 1; i < chosen.size(); i++)
+            {
+                column.arcs.push_back({b, chosen[i]});
+            }
+
+            std::sort(column.masters.begin(), column.masters.end());
+            std::sort(column.arcs.begin(), column.arcs.end());
+
+            found.push_back({value, column});
+        }
+
+        std::stable_sort(found.begin(), found.end(), [](auto &a, auto &b)
+                         { return a.first > b.first; });
+
+        std::vector<Column> columns;
+        for (auto &[value, column] : found)
+        {
+            columns.push_back(column);
+        }
+
+        return columns;
+    }
+} // namespace column_generation
@@ -0,0 +1,272 @@
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <numeric>
+#include <algorithm>
+
+#include "wsn_data.h"
+#include "util_arc_values.h"
+
+namespace connectivity
+{
+    /**
+     * @brief Disjoint sets of nodes with path compression and union by size
+     *
+     */
+    class UnionFind
+    {
+    public:
+        UnionFind(int size);
+
+        int find(int node);
+
+        // join the sets of a and b, returns false if they were already in the same set
+        bool unite(int a, int b);
+
+    private:
+        std::vector<int> parent;
+        std::vector<int> size;
+    };
+
+    inline UnionFind::UnionFind(int size) : parent(size), size(size, 1)
+    {
+        std::iota(parent.begin(), parent.end(), 0);
+    }
+
+    inline int UnionFind::find(int node)
+    {
+        while (parent[node] != node)
+        {
+            parent[node] = parent[parent[node]];
+            node = parent[node];
+        }
+
+        return node;
+    }
+
+    inline bool UnionFind::unite(int a, int b)
+    {
+        a = find(a);
+        b = find(b);
+
+        if (a == b)
+        {
+            return false;
+        }
+
+        if (size[a] < size[b])
+        {
+            std::swap(a, b);
+        }
+
+        parent[b] = a;
+        size[a] += size[b];
+
+        return true;
+    }
+
+    /**
+     * @brief Find the components of an integer solution that are not connected to a sink.
+     * Each dominating node has one incoming arc, so these components contain a cycle.
+     *
+     * @param instance is the problem instance
+     * @param arc_value is the value of x(i)(j) for the arcs between nodes
+     * @param sink_value is the sum of the arcs from the sinks to each node
+     * @return std::vector<std::vector<int>> with the nodes of each subtour
+     */
+    inline std::vector<std::vector<int>> find_subtours(WSN_data &instance,
+                                                const ArcValues &arc_value,
+                                                const std::vector<double> &sink_value)
+    {
+        UnionFind components(instance.n);
+        std::vector<bool> has_arc(instance.n, false);
+
+        for (int i = 0; i < instance.n; i++)
+        {
+            for (int p = 0; p < arc_value.degree(i); p++)
+            {
+                int j = arc_value.head(i, p);
+
+                if (arc_value.at(i, p) > 0.5)
+                {
+                    components.unite(i, j);
+                    has_arc[i] = has_arc[j] = true;
+                }
+            }
+        }
+
+        std::vector<bool> connected_to_sink(instance.n, false);
+
+        for (int i = 0; i < instance.n; i++)
+        {
+            if (sink_value[i] > 0.5)
+            {
+                connected_to_sink[components.find(i)] = true;
+            }
+        }
+
+        std::vector<int> subtour_index(instance.n, -1);
+        std::vector<std::vector<int>> subtours;
+
+        for (int i = 0; i < instance.n; i++)
+        {
+            int root = components.find(i);
+
+            if (!has_arc[i] || connected_to_sink[root])
+            {
+                continue;
+            }
+
+            if (subtour_index[root] < 0)
+            {
+                subtour_index[root] = subtours.size();
+                subtours.push_back({});
+            }
+
+            subtours[subtour_index[root]].push_back(i);
+        }
+
+        return subtours;
+    }
+
+    /**
+     * @brief Separate connectivity cuts x(in(S)) >= y(v) + z(v) of a fractional solution.
+     * For each dominating node v a max flow from the sinks to v is computed on the capacities
+     * given by x; when it is smaller than y(v) + z(v), the nodes not reachable from the sinks
+     * on the residual graph define a violated cut. The residual capacities are kept per arc,
+     * so each augmenting path costs O(n + m).
+     *
+     * @param instance is the problem instance
+     * @param arc_value is the value of x(i)(j) for the arcs between nodes
+     * @param sink_value is the sum of the arcs from the sinks to each node
+     * @param demand is the value of y(v) + z(v) of each node
+     * @param tolerance is the minimum violation of a cut
+     * @return std::vector<std::pair<int, std::vector<int>>> with the node v and the set S of each cut
+     */
+    inline std::vector<std::pair<int, std::vector<int>>> separate_min_cuts(WSN_data &instance,
+                                                                    const ArcValues &arc_value,
+                                                                    const std::vector<double> &sink_value,
+                                                                    const std::vector<double> &demand,
+                                                                    double tolerance = 1e-3)
+    {
+        int source = instance.n;
+        std::vector<std::pair<int, std::vector<int>>> cuts;
+        std::vector<std::vector<bool>> found_sets;
+
+        // the source is the extra node connected to every node by the sink arcs, parent_arc is the
+        // position of the arc (parent, node) on the list of the parent (-1 for the sink arcs)
+        std::vector<int> parent(instance.n + 1);
+        std::vector<int> parent_arc(instance.n);
+
+        for (int v = 0; v < instance.n; v++)
+        {
+            if (demand[v] <= tolerance)
+            {
+                continue;
+            }
+
+            ArcValues residual(arc_value);
+            std::vector<double> residual_sink(sink_value);
+
+            double flow = 0;
+
+            // augmenting paths (bfs), stops when the demand of v is satisfied
+            while (flow < demand[v] - tolerance)
+            {
+                std::fill(parent.begin(), parent.end(), -1);
+                parent[source] = source;
+
+                std::queue<int> queue;
+
+                for (int to = 0; to < instance.n; to++)
+                {
+                    if (residual_sink[to] > 1e-9)
+                    {
+                        parent[to] = source;
+                        parent_arc[to] = -1;
+                        queue.push(to);
+                    }
+                }
+
+                while (!queue.empty() && parent[v] < 0)
+                {
+                    int from = queue.front();
+                    queue.pop();
+
+                    for (int p = 0; p < residual.degree(from); p++)
+                    {
+                        int to = residual.head(from, p);
+
+                        if (parent[to] < 0 && residual.at(from, p) > 1e-9)
+                        {
+                            parent[to] = from;
+                            parent_arc[to] = p;
+                            queue.push(to);
+                        }
+                    }
+                }
+
+                if (parent[v] < 0)
+                {
+                    break;
+                }
+
+                double bottleneck = demand[v] - flow;
+                for (int to = v; to != source; to = parent[to])
+                {
+                    double capacity = (parent[to] == source) ? residual_sink[to]
+                                                             : residual.at(parent[to], parent_arc[to]);
+
+                    bottleneck = std::min(bottleneck, capacity);
+                }
+
+                for (int to = v; to != source; to = parent[to])
+                {
+                    if (parent[to] == source)
+                    {
+                        residual_sink[to] -= bottleneck;
+                        continue;
+                    }
+
+                    residual.at(parent[to], parent_arc[to]) -= bottleneck;
+
+                    int back = residual.reverse(parent[to], parent_arc[to]);
+                    if (back >= 0)
+                    {
+                        residual.at(to, back) += bottleneck;
+                    }
+                }
+
+                flow += bottleneck;
+            }
+
+            if (flow >= demand[v] - tolerance)
+            {
+                continue;
+            }
+
+            // the last bfs marked the nodes reachable from the sinks, the others are the set S
+            std::vector<bool> in_set(instance.n);
+            std::vector<int> set;
+
+            for (int i = 0; i < instance.n; i++)
+            {
+                in_set[i] = (parent[i] < 0);
+
+                if (in_set[i])
+                {
+                    set.push_back(i);
+                }
+            }
+
+            if (std::find(found_sets.begin(), found_sets.end(), in_set) == found_sets.end())
+            {
+                found_sets.push_back(in_set);
+                cuts.push_back({v, set});
+            }
+        }
+
+        return cuts;
+    }
+} // namespace connectivity
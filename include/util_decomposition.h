@@ -0,0 +1,97 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <limits>
+#include <algorithm>
+
+namespace decomposition
+{
+    /**
+     * @brief Number of trees of each component and the max weight of the trees
+     *
+     */
+    struct Allocation
+    {
+        double value;           // infinity if there is no feasible allocation
+        std::vector<int> trees; // number of trees of each component
+    };
+
+    /**
+     * @brief Distribute the trees among the components minimizing the max weight of the trees.
+     * Every component receives at least one tree and the value of a component with k trees is
+     * value[c][k] (infinity or a missing position if it is infeasible or was not solved).
+     *
+     * @param value is the value of each component for each number of trees (value[c][0] is not used)
+     * @param number_trees is the total number of trees
+     * @return Allocation with the min-max value and the trees of each component
+     */
+    inline Allocation min_max_allocation(const std::vector<std::vector<double>> &value, int number_trees)
+    {
+        const double infinity = std::numeric_limits<double>::infinity();
+        int components = value.size();
+
+        auto value_of = [&](int c, int k)
+        {
+            return (k < (int)value[c].size()) ? value[c][k] : infinity;
+        };
+
+        // best[c][k] is the min-max value of the components 0, ..., c - 1 using k trees
+        std::vector<std::vector<double>> best(components + 1, std::vector<double>(number_trees + 1, infinity));
+        std::vector<std::vector<int>> choice(components + 1, std::vector<int>(number_trees + 1, 0));
+
+        best[0][0] = -infinity;
+
+        for (int c = 0; c < components; c++)
+        {
+            for (int k = 1; k <= number_trees; k++)
+            {
+                for (int trees = 1; trees <= k; trees++)
+                {
+                    double candidate = std::max(best[c][k - trees], value_of(c, trees));
+
+                    if (candidate < best[c + 1][k])
+                    {
+                        best[c + 1][k] = candidate;
+                        choice[c + 1][k] = trees;
+                    }
+                }
+            }
+        }
+
+        Allocation allocation({best[components][number_trees], std::vector<int>(components, 0)});
+
+        if (allocation.value == infinity)
+        {
+            return allocation;
+        }
+
+        for (int c = components, k = number_trees; c > 0; c--)
+        {
+            allocation.trees[c - 1] = choice[c][k];
+            k -= choice[c][k];
+        }
+
+        return allocation;
+    }
+
+    /**
+     * @brief Results table of the runs of the components, kept apart from the table of the
+     * decomposed run (results.csv gives results_components.csv)
+     *
+     * @param summary_path is the results table of the decomposed run
+     * @return std::string with the path of the table of the components
+     */
+    inline std::string components_table(const std::string &summary_path)
+    {
+        auto dot = summary_path.find_last_of('.');
+        auto slash = summary_path.find_last_of('/');
+
+        if (dot == std::string::npos || (slash != std::string::npos && dot < slash))
+        {
+            return summary_path + "_components";
+        }
+
+        return summary_path.substr(0, dot) + "_components" + summary_path.substr(dot);
+    }
+} // namespace decomposition
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vector>
+#include <set>
+#include <array>
+#include <algorithm>
+#include <iterator>
+
+/**
+ * @brief List the triangles {a, b, c} (a < b < c) of the undirected graph given by the
+ * lists of adjacency (an edge exists if any of the arcs exists). Each edge is oriented from
+ * the node with lower degree to the one with higher degree, so every triangle is found once
+ * by intersecting the sorted out-neighbors of the ends of an edge, in O(m^1.5).
+ *
+ * @param adj_list are the out-neighbors of each node (e.g. adj_list_from_v)
+ * @return std::vector<std::array<int, 3>> with the nodes of each triangle in increasing order
+ */
+std::vector<std::array<int, 3>> list_triangles(const std::vector<std::set<int>> &adj_list);
+
+/**
+ * @brief List the ordered triples (i, j, k) of distinct nodes such that the arcs (i, j), (j, k)
+ * and (i, k) exist, in lexicographic order. It is the same set given by checking every triple
+ * of nodes, but only the triangles of the graph are visited.
+ *
+ * @param adj_list are the out-neighbors of each node (e.g. adj_list_from_v)
+ * @return std::vector<std::array<int, 3>> with the triples (i, j, k)
+ */
+std::vector<std::array<int, 3>> list_ordered_triangles(const std::vector<std::set<int>> &adj_list);
+
@@ -5,6 +5,7 @@
 #include <set>
 #include <sstream>
 #include <fstream>
+#include <stdexcept>
 
 /**
  * @brief Transform a string with a integer number written in a int number
@@ -12,13 +13,7 @@
  * @param num is a string input with a number
  * @return int  
  */
-int numero(std::string num)
-{
-    std::stringstream ss(num);
-    int retorno = 0;
-    ss >> retorno;
-    return retorno;
-}
+int numero(std::string num);
 
 /**
  * @brief Transform a string with a double number written in a double number
@@ -26,13 +21,7 @@ int numero(std::string num)
  * @param num is a string input with a number
  * @return double 
  */
-double numerodouble(std::string num)
-{
-    std::stringstream ss(num);
-    double retorno = 0;
-    ss >> retorno;
-    return retorno;
-}
+double numerodouble(std::string num);
 
 /**
  * @brief Transform a matrix of adjacency in a list of adjacency. 
@@ -42,25 +31,7 @@ double numerodouble(std::string num)
  * @param adj_matrix is the matrix of adjacency
  * @return std::vector<std::set<int>> list of adjacency
  */
-std::vector<std::set<int>> to_adj_list_out(std::vector<std::vector<int>> &adj_matrix)
-{
-    int n = adj_matrix.size();
-
-    std::vector<std::set<int>> adj_list(n, std::set<int>());
-
-    for (int from = 0; from < n; from++)
-    {
-        for (int to = 0; to < n; to++)
-        {
-            if (adj_matrix[from][to] == 1)
-            {
-                adj_list[from].insert(to);
-            }
-        }
-    }
-
-    return adj_list;
-}
+std::vector<std::set<int>> to_adj_list_out(std::vector<std::vector<int>> &adj_matrix);
 
 /**
  * @brief Transform a matrix of adjacency in a list of adjacency. 
@@ -70,25 +41,7 @@ std::vector<std::set<int>> to_adj_list_out(std::vector<std::vector<int>> &adj_ma
  * @param adj_matrix is the matrix of adjacency
  * @return std::vector<std::set<int>> list of adjacency
  */
-std::vector<std::set<int>> to_adj_list_in(std::vector<std::vector<int>> &adj_matrix)
-{
-    int n = adj_matrix.size();
-
-    std::vector<std::set<int>> adj_list(n, std::set<int>());
-
-    for (int from = 0; from < n; from++)
-    {
-        for (int to = 0; to < n; to++)
-        {
-            if (adj_matrix[from][to] == 1)
-            {
-                adj_list[to].insert(from);
-            }
-        }
-    }
-
-    return adj_list;
-}
+std::vector<std::set<int>> to_adj_list_in(std::vector<std::vector<int>> &adj_matrix);
 
 /**
  * @brief Data from a instance of a graph
@@ -102,7 +55,6 @@ struct Instance
     std::vector<std::vector<int>> adjacency_matrix;
 };
 
-
 /**
  * @brief Read a instance of WSN problem, as defined in https://github.com/seoruosa/instances/tree/main/MSCWSN
  * 
@@ -113,44 +65,58 @@ struct Instance
  */
 int read_instance_wsn(std::string instance_path,
                   std::vector<std::vector<double>> &weight_matrix,
-                  std::vector<std::vector<int>> &adjacency_matrix)
-{
-    int number_nodes;
-    int number_edges;
-    int entrada;
-    int saida;
-    std::string auxiliar;
-    std::ifstream arquivo(instance_path);
-
-    if (arquivo.is_open())
-    {
-        arquivo >> auxiliar;
-        number_nodes = numero(auxiliar);
-
-        arquivo >> auxiliar;
-        number_edges = numero(auxiliar);
-        
-        weight_matrix = std::vector<std::vector<double>>(number_nodes, std::vector<double>(number_nodes, 1000));
-        adjacency_matrix = std::vector<std::vector<int>>(number_nodes, std::vector<int>(number_nodes, 0));
+                  std::vector<std::vector<int>> &adjacency_matrix);
 
-        for (int i = 0; i < number_edges; i++)
-        {
-            arquivo >> auxiliar;
-            entrada = numero(auxiliar) - 1;
+/**
+ * @brief Edge {from, to} of an instance with its weight
+ * 
+ */
+struct WeightedEdge
+{
+    int from;
+    int to;
+    double weight;
+};
 
-            arquivo >> auxiliar;
-            saida = numero(auxiliar) - 1;
+/**
+ * @brief Write an instance on the MSCWSN text format (the format read by read_instance_wsn)
+ * 
+ * @param instance_path is the path of the written file
+ * @param number_nodes is the number of nodes
+ * @param edges are the edges of the instance (nodes indexed from 0), the weights are written with two decimals
+ */
+void write_instance_wsn(std::string instance_path, int number_nodes, const std::vector<WeightedEdge> &edges);
 
-            arquivo >> auxiliar;
-            weight_matrix[entrada][saida] = numerodouble(auxiliar);
-            weight_matrix[saida][entrada] = numerodouble(auxiliar);
-            
-            adjacency_matrix[entrada][saida] = 1;
-            adjacency_matrix[saida][entrada] = 1;
-        }
+/**
+ * @brief Write the binary cache of an instance: the magic "WSNB", the version (uint32), the number of nodes and of
+ * edges (int32) and each edge as (from, to) int32 and weight double, on the byte order of the machine
+ * 
+ * @param instance_path is the path of the written file
+ * @param number_nodes is the number of nodes
+ * @param edges are the edges of the instance (nodes indexed from 0)
+ */
+void write_instance_binary(std::string instance_path, int number_nodes, const std::vector<WeightedEdge> &edges);
 
-        arquivo.close();
-    }
+/**
+ * @brief Read the binary cache of an instance written by write_instance_binary
+ * 
+ * @param instance_path is a path to the instance
+ * @param weight_matrix pointer to a matrix of double where the weight matrix will be stored
+ * @param adjacency_matrix pointer to a matrix of int where the matrix of adjacency will be stored
+ * @return int the number of nodes of instance
+ */
+int read_instance_binary(std::string instance_path,
+                         std::vector<std::vector<double>> &weight_matrix,
+                         std::vector<std::vector<int>> &adjacency_matrix);
 
-    return number_nodes;
-}
\ No newline at end of file
+/**
+ * @brief Read an instance on the text format or, if the path ends with .wsnb, on the binary cache
+ * 
+ * @param instance_path is a path to the instance
+ * @param weight_matrix pointer to a matrix of double where the weight matrix will be stored
+ * @param adjacency_matrix pointer to a matrix of int where the matrix of adjacency will be stored
+ * @return int the number of nodes of instance
+ */
+int read_instance(std::string instance_path,
+                  std::vector<std::vector<double>> &weight_matrix,
+                  std::vector<std::vector<int>> &adjacency_matrix);
@@ -0,0 +1,256 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <functional>
+#include <limits>
+#include <cmath>
+
+#include "wsn_data.h"
+#include "util_lower_bounds.h"
+
+/**
+ * @brief Lagrangian bound of the weight of the heaviest tree, computed without any LP.
+ *
+ * The coupling T >= weight of tree k is kept in its aggregated form: T >= (total weight) / K and
+ * T >= weight of the tree with most masters. With M masters, the forest has at least M - K arcs and
+ * some tree at least ceil(M / K) of them (see util_lower_bounds.h), so T >= g(M), where g(M) uses
+ * the lightest edges. The domination rows, sum of y(j) for j in N[i] >= 1, are relaxed with
+ * multipliers mu(i) >= 0:
+ *
+ * L(mu) = sum mu(i) + min over M of [ g(M) - (M largest c(j)) ],  c(j) = sum of mu(i) for i dominated by j
+ *
+ * which is solved in O(m + n log n) and gives a lower bound for any mu >= 0. The multipliers are
+ * updated by subgradient optimization.
+ */
+namespace lagrangian
+{
+    class DominationRelaxation
+    {
+    public:
+        DominationRelaxation(WSN_data &instance);
+
+        /**
+         * @brief Solve the relaxed problem for the given multipliers
+         *
+         * @param mu are the multipliers of the domination rows (one by node)
+         * @param masters are the masters of the solution of the relaxed problem (output)
+         * @return double is the value of the Lagrangian function (a lower bound of T)
+         */
+        double solve(const std::vector<double> &mu, std::vector<int> &masters);
+
+        /**
+         * @brief Subgradient of the Lagrangian function: 1 - number of masters that dominate each node
+         *
+         * @param masters are the masters of the solution of the relaxed problem
+         * @return std::vector<double> with one value by node
+         */
+        std::vector<double> subgradient(const std::vector<int> &masters);
+
+    private:
+        WSN_data &instance;
+
+        // lower bound of T for each number of masters (infinity if the number is not possible)
+        std::vector<double> weight_by_masters;
+    };
+
+    struct Result
+    {
+        double bound = 0;         // best lower bound found
+        int iterations = 0;       // number of subgradient iterations
+        std::vector<double> mu;   // multipliers of the best bound
+    };
+
+    /**
+     * @brief Maximize the Lagrangian function by subgradient optimization (step of Polyak, halved
+     * when the bound does not improve)
+     *
+     * @param instance is the problem instance
+     * @param upper_bound is the value of a known solution, used on the step size (must be finite)
+     * @param max_iterations is the maximum number of iterations
+     * @param on_improvement is called with the iteration and the bound when the bound improves
+     * @return Result with the best bound
+     */
+    Result subgradient_optimization(WSN_data &instance, double upper_bound, int max_iterations = 1000,
+                                    std::function<void(int, double)> on_improvement = nullptr);
+
+    inline DominationRelaxation::DominationRelaxation(WSN_data &instance) : instance(instance)
+    {
+        const double infinity = std::numeric_limits<double>::infinity();
+
+        int K = std::max(1, instance.number_trees);
+        int min_masters = std::max(K, lower_bounds::masters_lower_bound(instance));
+
+        auto weights = lower_bounds::sorted_edge_weights(instance);
+        int number_edges = weights.size();
+
+        // lightest[e] = sum of the e lightest edges
+        std::vector<double> lightest(number_edges + 1, 0.0);
+        std::partial_sum(weights.begin(), weights.end(), lightest.begin() + 1);
+
+        weight_by_masters = std::vector<double>(instance.n + 1, infinity);
+
+        for (int M = min_masters; M <= instance.n; M++)
+        {
+            int masters_of_largest = (M + K - 1) / K;
+
+            if (M - K > number_edges || masters_of_largest > number_edges)
+            {
+                continue;
+            }
+
+            weight_by_masters[M] = lightest[M - K] / K;
+
+            if (masters_of_largest >= 2)
+            {
+                weight_by_masters[M] = std::max(weight_by_masters[M], lightest[masters_of_largest]);
+            }
+        }
+    }
+
+    inline double DominationRelaxation::solve(const std::vector<double> &mu, std::vector<int> &masters)
+    {
+        const double infinity = std::numeric_limits<double>::infinity();
+
+        // profit of each node as a master
+        std::vector<double> profit(mu);
+
+        for (int j = 0; j < instance.n; j++)
+        {
+            for (auto &i : instance.adj_list_from_v[j])
+            {
+                profit[j] += mu[i];
+            }
+        }
+
+        std::vector<int> order(instance.n);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](int a, int b)
+                  { return profit[a] > profit[b]; });
+
+        double best = infinity;
+        int best_masters = 0;
+        double sum_profit = 0;
+
+        for (int M = 0; M <= instance.n; M++)
+        {
+            if (M > 0)
+            {
+                sum_profit += profit[order[M - 1]];
+            }
+
+            if (weight_by_masters[M] - sum_profit < best)
+            {
+                best = weight_by_masters[M] - sum_profit;
+                best_masters = M;
+            }
+        }
+
+        masters.assign(order.begin(), order.begin() + best_masters);
+
+        return std::accumulate(mu.begin(), mu.end(), 0.0) + best;
+    }
+
+    inline std::vector<double> DominationRelaxation::subgradient(const std::vector<int> &masters)
+    {
+        std::vector<double> g(instance.n, 1.0);
+
+        for (auto &j : masters)
+        {
+            g[j] -= 1;
+
+            for (auto &i : instance.adj_list_from_v[j])
+            {
+                g[i] -= 1;
+            }
+        }
+
+        return g;
+    }
+
+    inline Result subgradient_optimization(WSN_data &instance, double upper_bound, int max_iterations,
+                                    std::function<void(int, double)> on_improvement)
+    {
+        DominationRelaxation relaxation(instance);
+
+        Result result;
+        result.mu = std::vector<double>(instance.n, 0.0);
+
+        std::vector<double> mu(result.mu);
+        std::vector<int> masters;
+
+        result.bound = relaxation.solve(mu, masters);
+
+        if (on_improvement)
+        {
+            on_improvement(0, result.bound);
+        }
+
+        // infeasible relaxation (e.g. more trees than possible masters), or no finite target for the step
+        if (std::isinf(result.bound) || !std::isfinite(upper_bound))
+        {
+            return result;
+        }
+
+        double step_factor = 2.0;
+        int without_improvement = 0;
+
+        for (int iteration = 1; iteration <= max_iterations; iteration++)
+        {
+            result.iterations = iteration;
+
+            double value = relaxation.solve(mu, masters);
+
+            if (value > result.bound + 1e-9)
+            {
+                result.bound = value;
+                result.mu = mu;
+                without_improvement = 0;
+
+                if (on_improvement)
+                {
+                    on_improvement(iteration, result.bound);
+                }
+            }
+            else if (++without_improvement >= 30)
+            {
+                step_factor /= 2;
+                without_improvement = 0;
+            }
+
+            // the bound reached the known solution, or the step is too small to change it
+            if (result.bound >= upper_bound - 1e-6 || step_factor < 1e-4)
+            {
+                break;
+            }
+
+            auto g = relaxation.subgradient(masters);
+
+            // a node with mu = 0 and negative subgradient stays at zero, so it does not count on the norm
+            double norm = 0;
+            for (int i = 0; i < instance.n; i++)
+            {
+                if (g[i] > 0 || mu[i] > 0)
+                {
+                    norm += g[i] * g[i];
+                }
+            }
+
+            // the masters of the relaxed solution dominate all nodes
+            if (norm == 0)
+            {
+                break;
+            }
+
+            double step = step_factor * (upper_bound - value) / norm;
+
+            for (int i = 0; i < instance.n; i++)
+            {
+                mu[i] = std::max(0.0, mu[i] + step * g[i]);
+            }
+        }
+
+        return result;
+    }
+} // namespace lagrangian
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <numeric>
+
+#include "wsn_data.h"
+
+/**
+ * @brief Combinatorial lower bounds of the weight of the heaviest tree, computed in O(m log m)
+ * before the model is built.
+ *
+ * A tree with q >= 2 masters has at least one bridge and, as the arcs only join masters to
+ * bridges and every bridge has at least two arcs, it has at least q arcs. So a forest with M
+ * masters and K trees has at least M - K arcs, and some tree has at least ceil(M / K) masters.
+ */
+namespace lower_bounds
+{
+    struct Bounds
+    {
+        int masters = 0;          // minimum number of masters of a solution
+        double total_weight = 0;  // lightest M - K arcs divided by K
+        double largest_tree = 0;  // lightest ceil(M / K) arcs, if the tree has at least two masters
+
+        double value() const
+        {
+            return std::max(total_weight, largest_tree);
+        }
+    };
+
+    /**
+     * @brief Minimum number of masters: a master dominates at most max degree + 1 nodes, and nodes
+     * whose closed neighborhoods are disjoint need different masters (packing built greedily from
+     * the nodes with lowest degree)
+     *
+     * @param instance is the problem instance
+     * @return int is the lower bound on the number of masters
+     */
+    inline int masters_lower_bound(WSN_data &instance)
+    {
+        int max_degree = 0;
+
+        for (int i = 0; i < instance.n; i++)
+        {
+            max_degree = std::max(max_degree, (int)instance.adj_list_from_v[i].size());
+        }
+
+        int by_degree = (instance.n + max_degree) / (max_degree + 1);
+
+        std::vector<int> order(instance.n);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b)
+                         { return instance.adj_list_to_v[a].size() < instance.adj_list_to_v[b].size(); });
+
+        // a node is used if it is in the closed neighborhood of a node of the packing
+        std::vector<bool> used(instance.n, false);
+        int packing = 0;
+
+        for (auto &v : order)
+        {
+            bool disjoint = !used[v];
+
+            for (auto &from : instance.adj_list_to_v[v])
+            {
+                disjoint = disjoint && !used[from];
+            }
+
+            if (!disjoint)
+            {
+                continue;
+            }
+
+            packing++;
+
+            used[v] = true;
+            for (auto &from : instance.adj_list_to_v[v])
+            {
+                used[from] = true;
+            }
+        }
+
+        return std::max(by_degree, packing);
+    }
+
+    /**
+     * @brief Weights of the edges of the instance in increasing order (the lightest direction of each edge)
+     *
+     * @param instance is the problem instance
+     * @return std::vector<double> with the sorted weights
+     */
+    inline std::vector<double> sorted_edge_weights(WSN_data &instance)
+    {
+        std::vector<double> weights;
+
+        for (int i = 0; i < instance.n; i++)
+        {
+            for (auto &j : instance.adj_list_from_v[i])
+            {
+                bool reverse = instance.is_connected[j][i] == 1;
+
+                if (reverse && j < i)
+                {
+                    continue;
+                }
+
+                weights.push_back(reverse ? std::min(instance.weight[i][j], instance.weight[j][i]) : instance.weight[i][j]);
+            }
+        }
+
+        std::sort(weights.begin(), weights.end());
+
+        return weights;
+    }
+
+    /**
+     * @brief Compute the combinatorial lower bounds of an instance
+     *
+     * @param instance is the problem instance (the number of trees is used)
+     * @return Bounds with the number of masters and the bounds on the objective
+     */
+    inline Bounds combinatorial(WSN_data &instance)
+    {
+        Bounds bounds;
+
+        int K = std::max(1, instance.number_trees);
+
+        bounds.masters = masters_lower_bound(instance);
+
+        auto weights = sorted_edge_weights(instance);
+
+        auto lightest = [&](int count)
+        {
+            count = std::min(count, (int)weights.size());
+
+            return std::accumulate(weights.begin(), weights.begin() + std::max(0, count), 0.0);
+        };
+
+        bounds.total_weight = lightest(bounds.masters - K) / K;
+
+        int masters_of_largest = (bounds.masters + K - 1) / K;
+
+        if (masters_of_largest >= 2)
+        {
+            bounds.largest_tree = lightest(masters_of_largest);
+        }
+
+        return bounds;
+    }
+} // namespace lower_bounds
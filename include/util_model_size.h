@@ -0,0 +1,278 @@
+#pragma once
+
+#include <string>
+#include <stdexcept>
+#include <ostream>
+
+#include "wsn_data.h"
+#include "util_summary.h"
+
+/**
+ * @brief Size of a formulation estimated from the instance alone, before the model is built.
+ *
+ * The models create their Concert arrays dense ((n + K) x n for the arcs, and one such matrix per
+ * sink or per commodity on the multi-index formulations), but only the variables of the arcs of
+ * the instance reach cplex. With a = number of arcs and s = K n sink arcs, the extracted columns
+ * of each family are counted on a + s and the rows and nonzeros by the constraints of the family.
+ */
+namespace model_size
+{
+    enum class Family
+    {
+        Flow,           // 2-index flow and MTZ models (FlowModel*, MTZ*)
+        ThreeIndex,     // arcs indexed by sink (FlowModel3idx, FlowModel2-1*)
+        Commodity,      // one flow per node (MCFModel*)
+        SinkFlow,       // arcs and flows indexed by sink (MCFModel-weightAsFlow-base, MCF-weight-arc-Model)
+        Representative, // arcs indexed by the representative node of the tree (REPR-*)
+        LabeledTree,    // arcs indexed by the label of the tree (MAR-*)
+        Decomposition,  // only the 2-index master problem (Benders)
+        TreeColumns,    // master over tree columns and the pricing mip of a tree (ColumnGeneration)
+        Bound           // no model (Lagrangian)
+    };
+
+    // rough memory per object: a Concert variable with its name, a column or row of cplex
+    // (bounds, names and the presolved copy) and a nonzero on the Concert expressions and on cplex
+    const double bytes_per_variable = 200;
+    const double bytes_per_index = 200;
+    const double bytes_per_nonzero = 64;
+
+    /**
+     * @brief Family of a registered model
+     *
+     * @param model_name is the registered name of the model
+     * @return Family
+     */
+    inline Family family(const std::string &model_name)
+    {
+        auto starts_with = [&](const std::string &prefix)
+        { return model_name.compare(0, prefix.size(), prefix) == 0; };
+
+        if (model_name == "MCFModel-weightAsFlow-base" || model_name == "MCF-weight-arc-Model")
+        {
+            return Family::SinkFlow;
+        }
+
+        if (starts_with("MCFModel"))
+        {
+            return Family::Commodity;
+        }
+
+        if (model_name == "FlowModel3idx" || starts_with("FlowModel2-1"))
+        {
+            return Family::ThreeIndex;
+        }
+
+        if (starts_with("FlowModel") || starts_with("MTZ") || model_name == "check-instance")
+        {
+            return Family::Flow;
+        }
+
+        if (starts_with("REPR-"))
+        {
+            return Family::Representative;
+        }
+
+        if (starts_with("MAR-"))
+        {
+            return Family::LabeledTree;
+        }
+
+        if (model_name == "Benders")
+        {
+            return Family::Decomposition;
+        }
+
+        if (model_name == "ColumnGeneration")
+        {
+            return Family::TreeColumns;
+        }
+
+        if (model_name == "Lagrangian")
+        {
+            return Family::Bound;
+        }
+
+        throw std::invalid_argument("Unknown model for the size estimate: " + model_name);
+    }
+
+    struct ModelSize
+    {
+        double variables = 0; // variables created on Concert
+        double columns = 0;   // variables used by the constraints (extracted to cplex)
+        double rows = 0;
+        double nonzeros = 0;
+
+        double memory_mb() const
+        {
+            return (variables * bytes_per_variable + (columns + rows) * bytes_per_index + nonzeros * bytes_per_nonzero) /
+                   (1024.0 * 1024.0);
+        }
+
+        friend std::ostream &operator<<(std::ostream &os, const ModelSize &s)
+        {
+            os << "variables: " << (long)s.variables << " | columns: " << (long)s.columns << " | rows: " << (long)s.rows
+               << " | nonzeros: " << (long)s.nonzeros << " | memory: " << s.memory_mb() << " MB";
+
+            return os;
+        }
+    };
+
+    /**
+     * @brief Estimate the size of a formulation for the instance and its number of trees
+     *
+     * @param model_name is the registered name of the model
+     * @param instance is the problem instance
+     * @return ModelSize
+     */
+    inline ModelSize estimate(const std::string &model_name, WSN_data &instance)
+    {
+        double n = instance.n;
+        double K = instance.number_trees;
+
+        double a = 0;
+        for (auto &arcs : instance.adj_list_from_v)
+        {
+            a += arcs.size();
+        }
+
+        double s = K * n;
+        double arcs = a + s;
+        double dense = (n + K) * n;             // a dense 2-index arc matrix
+        double dense_sink = (n + K) * (n + K);  // a dense arc matrix of a sink or commodity
+
+        ModelSize size;
+
+        // y, z, x, N and T with the degree, domination and forest constraints of every model
+        size.variables = 2 * n + dense + 2;
+        size.columns = 2 * n + arcs + 2;
+        size.rows = 8 * n + a;
+        size.nonzeros = 6 * a + 2 * s + 12 * n;
+
+        switch (family(model_name))
+        {
+        case Family::Flow:
+            size.variables += dense;
+            size.columns += arcs;
+            size.rows += n + arcs;
+            size.nonzeros += 4 * arcs + 2 * n;
+            break;
+
+        case Family::ThreeIndex:
+            size.variables += 2 * K * dense_sink;
+            size.columns += 2 * K * arcs;
+            size.rows += K * (2 * n + arcs);
+            size.nonzeros += 2 * K * (3 * arcs + n);
+            break;
+
+        case Family::Commodity:
+            size.variables += K * dense_sink + 2 * K * n + n * dense_sink;
+            size.columns += K * arcs + 2 * K * n + n * arcs;
+            size.rows += n * (n + arcs) + K * (n + a);
+            size.nonzeros += 4 * n * arcs + 3 * K * arcs;
+            break;
+
+        case Family::SinkFlow:
+            size.variables += 2 * K * dense_sink + 2 * K * n;
+            size.columns += 2 * K * arcs + 2 * K * n;
+            size.rows += K * (2 * n + arcs);
+            size.nonzeros += K * (6 * arcs + 4 * n);
+            break;
+
+        case Family::Representative:
+            size.variables += n * n * n + 2 * n * n + dense + n;
+            size.columns += n * a + 2 * n * n + arcs + n;
+            size.rows += n * (2 * n + a) + arcs;
+            size.nonzeros += n * (4 * a + 4 * n) + 4 * arcs;
+            break;
+
+        case Family::LabeledTree:
+            size.variables += K * dense_sink + 2 * K * n + dense + n;
+            size.columns += K * arcs + 2 * K * n + arcs + n;
+            size.rows += K * (2 * n + a) + n + arcs;
+            size.nonzeros += K * (4 * a + 4 * n + 2 * s) + 4 * arcs;
+            break;
+
+        case Family::Decomposition:
+            break;
+
+        case Family::TreeColumns:
+            // no compact model: the master starts with a column per master node and the slacks, and the
+            // pricing mip has y, z, u, r and q, the dense n x n matrices of arcs and flows and the rows of a tree
+            size.variables = (2 * n + 1) + (5 * n + 2 * n * n);
+            size.columns = (2 * n + 1) + (5 * n + 2 * a);
+            size.rows = (2 * n + a / 2 + 1) + (7 * n + 3 * a + a / 2 + 2);
+            size.nonzeros = (2 * a + 4 * n + 1) + (16 * a + 16 * n);
+            break;
+
+        case Family::Bound:
+            size = ModelSize();
+            break;
+        }
+
+        return size;
+    }
+
+    /**
+     * @brief Check a model against a memory budget
+     *
+     * @param size is the estimated size of the model
+     * @param budget_mb is the budget in MB (0 or less is no budget)
+     * @return true if the model fits in the budget
+     */
+    inline bool fits(const ModelSize &size, double budget_mb)
+    {
+        return budget_mb <= 0 || size.memory_mb() <= budget_mb;
+    }
+
+    /**
+     * @brief Model to be built within a memory budget
+     *
+     * @param model_name is the chosen model
+     * @param fallback_model is the model used if the chosen one does not fit (empty for none)
+     * @param instance is the problem instance
+     * @param budget_mb is the budget in MB (0 or less is no budget)
+     * @return std::string with the chosen model if it fits, else the fallback if it fits, else empty
+     */
+    inline std::string model_within_budget(const std::string &model_name, const std::string &fallback_model,
+                                    WSN_data &instance, double budget_mb)
+    {
+        if (fits(estimate(model_name, instance), budget_mb))
+        {
+            return model_name;
+        }
+
+        if (!fallback_model.empty() && fits(estimate(fallback_model, instance), budget_mb))
+        {
+            return fallback_model;
+        }
+
+        return "";
+    }
+
+    /**
+     * @brief Summary of a run refused by the memory budget, with the estimated size of the model,
+     * so the run is recorded on the results table (the caller sets the time)
+     *
+     * @param model_name is the refused model
+     * @param instance is the problem instance
+     * @param relaxed is true if the relaxation was asked
+     * @return RunSummary with status OverMemoryBudget
+     */
+    inline RunSummary over_budget_run(const std::string &model_name, WSN_data &instance, bool relaxed)
+    {
+        auto size = estimate(model_name, instance);
+
+        RunSummary run;
+        run.instance = instance.name();
+        run.n = instance.n;
+        run.model = model_name;
+        run.number_trees = instance.number_trees;
+        run.relaxed = relaxed;
+        run.status = "OverMemoryBudget";
+        run.rows = (long)size.rows;
+        run.cols = (long)size.columns;
+        run.nonzeros = (long)size.nonzeros;
+
+        return run;
+    }
+} // namespace model_size
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <chrono>
+#include <ostream>
+
+#include <malloc.h>
+#include <sys/resource.h>
+
+/**
+ * @brief Resources used by the phases of a run (time, peak resident memory and heap), to tell
+ * the time and memory of our code (parse, build, output) from the ones of the solver
+ *
+ */
+namespace perf
+{
+    namespace memory
+    {
+        /**
+         * @brief Peak resident set size of the process
+         *
+         * @return double with the peak in MB
+         */
+        inline double peak_rss_mb()
+        {
+            rusage usage;
+            getrusage(RUSAGE_SELF, &usage);
+
+            // KB on linux
+            return usage.ru_maxrss / 1024.0;
+        }
+
+        /**
+         * @brief Heap in use by malloc on the process (every new, Concert and cplex included)
+         *
+         * @return double with the heap in MB (0 if the C library does not give it)
+         */
+        inline double heap_in_use_mb()
+        {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+            auto info = mallinfo2();
+
+            return (info.uordblks + info.hblkhd) / (1024.0 * 1024.0);
+#else
+            return 0;
+#endif
+        }
+    } // namespace memory
+
+    enum class Phase
+    {
+        Parse,      // read the instance
+        Preprocess, // reductions of the instance
+        Build,      // create the variables and constraints on Concert (and the relaxed copy)
+        Extract,    // extract the model to cplex
+        Solve,      // solve (and the bounds and heuristics of the runs without cplex)
+        Output      // export the model, print the solution and the output files
+    };
+
+    const int number_phases = 6;
+
+    /**
+     * @brief Name of a phase, used on the columns of the results table
+     *
+     * @param phase is the phase
+     * @return std::string
+     */
+    inline std::string phase_name(Phase phase)
+    {
+        const std::string names[number_phases] = {"parse", "preprocess", "build", "extract", "solve", "output"};
+
+        return names[(int)phase];
+    }
+
+    struct PhaseMetrics
+    {
+        double time = 0;        // seconds on the phase
+        double peak_rss_mb = 0; // peak resident memory of the process at the end of the phase (0 if it did not run)
+        double heap_mb = 0;     // heap allocated on the phase and not freed at its end (negative if it freed more)
+    };
+
+    /**
+     * @brief Record the phases of a run. A phase can be started more than once (e.g. the output
+     * before and after the solve), its time and heap are added up. The memory is of the whole
+     * process, so runs solved at the same time on threads share it.
+     *
+     */
+    class PhaseRecorder
+    {
+    public:
+        // start a phase, the running one is stopped
+        void start(Phase phase);
+
+        // stop the running phase (nothing if none is running)
+        void stop();
+
+        // forget the phases from phase on (e.g. the ones of the previous K of a sweep)
+        void clear(Phase from);
+
+        const PhaseMetrics &operator[](Phase phase) const;
+
+        friend std::ostream &operator<<(std::ostream &os, const PhaseRecorder &recorder);
+
+        std::array<PhaseMetrics, number_phases> metrics;
+
+    private:
+        int running = -1;
+        std::chrono::steady_clock::time_point start_time;
+        double start_heap = 0;
+    };
+
+    inline void PhaseRecorder::start(Phase phase)
+    {
+        stop();
+
+        running = (int)phase;
+        start_heap = memory::heap_in_use_mb();
+        start_time = std::chrono::steady_clock::now();
+    }
+
+    inline void PhaseRecorder::stop()
+    {
+        if (running < 0)
+        {
+            return;
+        }
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+
+        auto &phase = metrics[running];
+        phase.time += elapsed.count();
+        phase.heap_mb += memory::heap_in_use_mb() - start_heap;
+        phase.peak_rss_mb = memory::peak_rss_mb();
+
+        running = -1;
+    }
+
+    inline void PhaseRecorder::clear(Phase from)
+    {
+        if (running >= (int)from)
+        {
+            running = -1;
+        }
+
+        for (int p = (int)from; p < number_phases; p++)
+        {
+            metrics[p] = PhaseMetrics();
+        }
+    }
+
+    inline const PhaseMetrics &PhaseRecorder::operator[](Phase phase) const
+    {
+        return metrics[(int)phase];
+    }
+
+    inline std::ostream &operator<<(std::ostream &os, const PhaseRecorder &recorder)
+    {
+        for (int p = 0; p < number_phases; p++)
+        {
+            auto &phase = recorder.metrics[p];
+
+            os << phase_name((Phase)p) << ": " << phase.time << " s | peak rss: " << phase.peak_rss_mb
+               << " MB | heap: " << phase.heap_mb << " MB" << std::endl;
+        }
+
+        return os;
+    }
+} // namespace perf
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <ilcplex/ilocplex.h>
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <mutex>
+#include <cmath>
+#include <algorithm>
+
+#include "util_results.h"
+
+/**
+ * @brief Generic callback that records the trajectory of the incumbent and the best bound
+ * during the branch and bound. A sample (time, incumbent, best bound, nodes, gap) is stored
+ * only when the incumbent or the best bound changes.
+ *
+ */
+class ProgressRecorder : public IloCplex::Callback::Function
+{
+public:
+    ProgressRecorder();
+
+    /**
+     * @brief Called by cplex on the global progress context
+     *
+     * @param context is the cplex callback context
+     */
+    void invoke(const IloCplex::Callback::Context &context) override;
+
+    /**
+     * @brief Store a sample if the incumbent or the best bound changed since the last one
+     *
+     * @param incumbent is the objective value of the best integer solution
+     * @param best_bound is the best bound of the search
+     * @param nodes is the number of processed nodes
+     */
+    void add_sample(double incumbent, double best_bound, long nodes);
+
+    /**
+     * @brief Store the final values of a solved model
+     *
+     * @param cplex is the cplex object after solve
+     */
+    void add_final_sample(IloCplex &cplex);
+
+    /**
+     * @brief Write the trajectory, one sample by line
+     *
+     * @param out is the output stream
+     */
+    void write(std::ostream &out);
+
+    /**
+     * @brief Write the trajectory on the file at path
+     *
+     * @param path is the path of the output file
+     */
+    void write(std::string path);
+
+private:
+    struct Sample
+    {
+        double time;
+        double incumbent;
+        double best_bound;
+        long nodes;
+        double gap;
+    };
+
+    std::vector<Sample> samples;
+    std::mutex samples_lock;
+    std::chrono::high_resolution_clock::time_point start;
+
+    // cplex reports values greater than this when there is no incumbent
+    static constexpr double no_incumbent = 1e75;
+
+    // relative gap as calculated by cplex
+    static double relative_gap(double incumbent, double best_bound);
+};
+
+inline ProgressRecorder::ProgressRecorder() : samples({}), start(perf::time::start())
+{
+}
+
+inline void ProgressRecorder::invoke(const IloCplex::Callback::Context &context)
+{
+    if (context.inGlobalProgress())
+    {
+        double incumbent = context.getDoubleInfo(IloCplex::Callback::Context::Info::BestSolution);
+        double best_bound = context.getDoubleInfo(IloCplex::Callback::Context::Info::BestBound);
+        long nodes = context.getLongInfo(IloCplex::Callback::Context::Info::NodeCount);
+
+        add_sample(incumbent, best_bound, nodes);
+    }
+}
+
+inline void ProgressRecorder::add_sample(double incumbent, double best_bound, long nodes)
+{
+    std::lock_guard<std::mutex> guard(samples_lock);
+
+    auto changed = [](double a, double b)
+    {
+        return std::abs(a - b) > 1e-9 * std::max(1.0, std::abs(a));
+    };
+
+    if (!samples.empty() && !changed(samples.back().incumbent, incumbent) && !changed(samples.back().best_bound, best_bound))
+    {
+        return;
+    }
+
+    samples.push_back({perf::time::duration(start).count(), incumbent, best_bound, nodes, relative_gap(incumbent, best_bound)});
+}
+
+inline void ProgressRecorder::add_final_sample(IloCplex &cplex)
+{
+    double incumbent = cplex.isPrimalFeasible() ? cplex.getObjValue() : no_incumbent;
+
+    add_sample(incumbent, cplex.getBestObjValue(), cplex.getNnodes());
+}
+
+inline void ProgressRecorder::write(std::ostream &out)
+{
+    std::lock_guard<std::mutex> guard(samples_lock);
+
+    out << "time\tincumbent\tbest_bound\tnodes\tgap" << std::endl;
+
+    for (auto &sample : samples)
+    {
+        out << sample.time << "\t";
+
+        if (std::abs(sample.incumbent) >= no_incumbent)
+        {
+            out << "inf";
+        }
+        else
+        {
+            out << sample.incumbent;
+        }
+
+        out << "\t" << sample.best_bound << "\t" << sample.nodes << "\t" << sample.gap << std::endl;
+    }
+}
+
+inline void ProgressRecorder::write(std::string path)
+{
+    std::ofstream out(path.c_str());
+
+    write(out);
+}
+
+inline double ProgressRecorder::relative_gap(double incumbent, double best_bound)
+{
+    if (std::abs(incumbent) >= no_incumbent)
+    {
+        return 1.0;
+    }
+
+    return std::abs(incumbent - best_bound) / (1e-10 + std::abs(incumbent));
+}
@@ -11,7 +11,7 @@
  * @param a is a string with a integer number
  * @return int 
  */
-int get_number(std::string a)
+inline int get_number(std::string a)
 {
     const std::regex number_reg("\\d+");
     std::smatch n_match;
@@ -31,7 +31,7 @@ int get_number(std::string a)
  * @param a is a string with a pair of integer numbers separated by space
  * @return std::pair<int, int> is the pair of integer numbers
  */
-std::pair<int, int> get_pair(std::string a)
+inline std::pair<int, int> get_pair(std::string a)
 {
     const std::regex pieces_regex("(\\d+)[\\s\\t]+(\\w+)");
     std::smatch pieces_match;
@@ -58,7 +58,7 @@ std::pair<int, int> get_pair(std::string a)
  * @param skip_columns is the number of columns to be skipped
  * @return std::vector<std::vector<int>> is a matrix with size of (rows, columns)
  */
-std::vector<std::vector<int>> get_int_matrix(std::ifstream &input_file, int rows, int columns, int skip_columns)
+inline std::vector<std::vector<int>> get_int_matrix(std::ifstream &input_file, int rows, int columns, int skip_columns)
 {
     std::string string_line;
     std::regex number_reg("\\d+");
@@ -243,6 +243,41 @@ void print_matrix(std::vector<std::vector<T>> &matrix,
     print_matrix(matrix, var_name, std::cout);
 }
 
+/**
+ * @brief Print a solution given by its arcs, masters and bridges (same format of the solution read from cplex)
+ * 
+ * @param edges is the list of arcs {from, to} of solution
+ * @param masters is the list of master nodes
+ * @param bridges is the list of bridge nodes
+ * @param sum_to_index is a constant to be summed to the index of nodes
+ * @param cout is stream output
+ */
+inline void print_solution(std::vector<std::vector<int>> &edges, 
+                    std::vector<int> &masters, 
+                    std::vector<int> &bridges, 
+                    int sum_to_index, 
+                    std::ostream &cout)
+{
+    std::vector<std::vector<int>> matrix_x;
+    for (auto &edge : edges)
+    {
+        matrix_x.push_back({edge[0] + sum_to_index, edge[1] + sum_to_index});
+    }
+    print_matrix(matrix_x, "X", cout);
+
+    for (auto &[nodes, name] : {std::make_pair(masters, "Y"), std::make_pair(bridges, "z")})
+    {
+        std::vector<std::vector<int>> vec;
+        for (auto &node : nodes)
+        {
+            vec.push_back({node + sum_to_index});
+        }
+        print_matrix(vec, name, cout);
+    }
+
+    cout << "EOF" << std::endl;
+}
+
 /**
  * @brief Methods for printing output
  * 
@@ -255,7 +290,7 @@ namespace print
      * @param fmt is the output format
      * @return std::string 
      */
-    std::string time_now(const char *fmt)
+    inline std::string time_now(const char *fmt)
     {
         auto time = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
 
@@ -272,7 +307,7 @@ namespace print
      * 
      * @return std::string 
      */
-    std::string time_now()
+    inline std::string time_now()
     {
         return time_now("%Y-%m-%d %H:%M:%S");
     }
@@ -291,7 +326,7 @@ namespace perf
          * 
          * @return std::chrono::high_resolution_clock::time_point 
          */
-        std::chrono::high_resolution_clock::time_point start()
+        inline std::chrono::high_resolution_clock::time_point start()
         {
             return std::chrono::high_resolution_clock::now();
         }
@@ -302,7 +337,7 @@ namespace perf
          * @param start_ is the start of event
          * @return std::chrono::duration<double> returns the durations of event in seconds
          */
-        std::chrono::duration<double> duration(std::chrono::high_resolution_clock::time_point start_)
+        inline std::chrono::duration<double> duration(std::chrono::high_resolution_clock::time_point start_)
         {
             auto end_gen = start();
             std::chrono::duration<double> duration(end_gen - start_);
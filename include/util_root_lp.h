@@ -0,0 +1,187 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+
+/**
+ * @brief Solution of the root LP of a formulation (values, reduced costs and duals), written on a
+ * compact binary file to compare formulations without the text outputs of the relaxation
+ *
+ */
+namespace root_lp
+{
+    struct Solution
+    {
+        int n = 0;
+        int number_trees = 0;
+        double objective = 0;
+
+        // one entry per node
+        std::vector<double> y_value;
+        std::vector<double> y_reduced_cost;
+        std::vector<double> z_value;
+        std::vector<double> z_reduced_cost;
+
+        // one entry per arc x[from][to] of the instance, the arcs of the sinks have from >= n
+        std::vector<int> arc_from;
+        std::vector<int> arc_to;
+        std::vector<double> arc_value;
+        std::vector<double> arc_reduced_cost;
+
+        // one entry per constraint of the formulation, on the order they were added (NaN if it is not linear)
+        std::vector<double> duals;
+    };
+
+    const char binary_magic[4] = {'W', 'S', 'N', 'L'};
+    const uint32_t binary_version = 1;
+
+    template <typename T>
+    void write_array(std::ofstream &out, const std::vector<T> &values)
+    {
+        out.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(T));
+    }
+
+    template <typename T>
+    void read_array(std::ifstream &in, std::vector<T> &values, uint64_t size)
+    {
+        values.resize(size);
+        in.read(reinterpret_cast<char *>(values.data()), size * sizeof(T));
+    }
+
+    /**
+     * @brief Write the solution: the magic "WSNL", the version (uint32), n and K (int32), the objective
+     * (double), the number of arcs and of duals (uint64), then the arrays y value, y reduced cost,
+     * z value, z reduced cost (n doubles each), arc from, arc to (int32), arc value, arc reduced cost
+     * (doubles) and the duals, on the byte order of the machine
+     *
+     * @param path is the path of the written file
+     * @param s is the solution of the root LP
+     */
+    inline void write(const std::string &path, const Solution &s)
+    {
+        std::ofstream out(path, std::ios::binary);
+
+        if (!out.is_open())
+        {
+            throw std::runtime_error("Could not write the root LP " + path);
+        }
+
+        int32_t header[2] = {s.n, s.number_trees};
+        uint64_t sizes[2] = {s.arc_from.size(), s.duals.size()};
+
+        out.write(binary_magic, sizeof(binary_magic));
+        out.write(reinterpret_cast<const char *>(&binary_version), sizeof(binary_version));
+        out.write(reinterpret_cast<const char *>(header), sizeof(header));
+        out.write(reinterpret_cast<const char *>(&s.objective), sizeof(s.objective));
+        out.write(reinterpret_cast<const char *>(sizes), sizeof(sizes));
+
+        write_array(out, s.y_value);
+        write_array(out, s.y_reduced_cost);
+        write_array(out, s.z_value);
+        write_array(out, s.z_reduced_cost);
+
+        std::vector<int32_t> from(s.arc_from.begin(), s.arc_from.end());
+        std::vector<int32_t> to(s.arc_to.begin(), s.arc_to.end());
+
+        write_array(out, from);
+        write_array(out, to);
+        write_array(out, s.arc_value);
+        write_array(out, s.arc_reduced_cost);
+        write_array(out, s.duals);
+    }
+
+    /**
+     * @brief Read a solution written by write
+     *
+     * @param path is the path of the file
+     * @return Solution
+     */
+    inline Solution read(const std::string &path)
+    {
+        std::ifstream in(path, std::ios::binary);
+
+        char magic[4];
+        uint32_t version = 0;
+        int32_t header[2] = {0, 0};
+        uint64_t sizes[2] = {0, 0};
+
+        Solution s;
+
+        in.read(magic, sizeof(magic));
+        in.read(reinterpret_cast<char *>(&version), sizeof(version));
+        in.read(reinterpret_cast<char *>(header), sizeof(header));
+        in.read(reinterpret_cast<char *>(&s.objective), sizeof(s.objective));
+        in.read(reinterpret_cast<char *>(sizes), sizeof(sizes));
+
+        if (!in || !std::equal(magic, magic + 4, binary_magic) || version != binary_version || header[0] < 0)
+        {
+            throw std::runtime_error("Invalid root LP " + path);
+        }
+
+        s.n = header[0];
+        s.number_trees = header[1];
+
+        read_array(in, s.y_value, s.n);
+        read_array(in, s.y_reduced_cost, s.n);
+        read_array(in, s.z_value, s.n);
+        read_array(in, s.z_reduced_cost, s.n);
+
+        std::vector<int32_t> from, to;
+
+        read_array(in, from, sizes[0]);
+        read_array(in, to, sizes[0]);
+        read_array(in, s.arc_value, sizes[0]);
+        read_array(in, s.arc_reduced_cost, sizes[0]);
+        read_array(in, s.duals, sizes[1]);
+
+        if (!in)
+        {
+            throw std::runtime_error("Invalid root LP " + path);
+        }
+
+        s.arc_from.assign(from.begin(), from.end());
+        s.arc_to.assign(to.begin(), to.end());
+
+        return s;
+    }
+
+    /**
+     * @brief Reduced cost fixing of binary variables of a minimization. A variable at a bound of
+     * the root LP with reduced cost d takes the other bound only on solutions of value at least
+     * objective + |d|, so it is fixed at its bound if that exceeds the upper bound (the solutions
+     * as good as the upper bound are kept).
+     *
+     * @param values are the values of the variables on the root LP
+     * @param reduced_costs are the reduced costs of the variables on the root LP
+     * @param objective is the value of the root LP
+     * @param upper_bound is the value of a known solution
+     * @return std::vector<int> with the value each variable is fixed at, -1 if it is not fixed
+     */
+    inline std::vector<int> reduced_cost_fixings(const std::vector<double> &values, const std::vector<double> &reduced_costs,
+                                          double objective, double upper_bound)
+    {
+        const double at_bound = 1e-6;
+        double gap = upper_bound - objective + 1e-6 * std::max(1.0, std::abs(upper_bound));
+
+        std::vector<int> fixings(values.size(), -1);
+
+        for (size_t v = 0; v < values.size(); v++)
+        {
+            if (values[v] <= at_bound && reduced_costs[v] > gap)
+            {
+                fixings[v] = 0;
+            }
+            else if (values[v] >= 1 - at_bound && -reduced_costs[v] > gap)
+            {
+                fixings[v] = 1;
+            }
+        }
+
+        return fixings;
+    }
+} // namespace root_lp
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <string>
+#include <stdexcept>
+
+/**
+ * @brief Resources and determinism of the solver, passed to every formulation (the defaults keep
+ * the behaviour of cplex, except the time limit of 600 s used by the experiments)
+ *
+ */
+struct SolverParams
+{
+    double time_limit = 600; // seconds of each solve
+    int threads = 0;         // 0 lets cplex decide (every core)
+    int parallel_mode = 0;   // 1 deterministic, -1 opportunistic, 0 lets cplex decide
+    double work_memory = 0;  // MB of the tree before node files are used (0 keeps the default of cplex)
+    int node_file = -1;      // 0 no node file, 1 in memory compressed, 2 on disk, 3 on disk compressed (-1 keeps the default)
+    std::string work_dir;    // directory of the node files (empty keeps the default of cplex)
+    int lp_method = 0;       // algorithm of the LPs and of the root of the mip (0 lets cplex decide)
+    int crossover = 0;       // crossover after the barrier: -1 off, 1 primal, 2 dual (0 lets cplex decide)
+};
+
+namespace solver_params
+{
+    /**
+     * @brief Parallel mode of cplex by name
+     *
+     * @param name is auto, deterministic or opportunistic
+     * @return int with the value of the cplex parameter
+     */
+    inline int parallel_mode(const std::string &name)
+    {
+        if (name == "auto")
+        {
+            return 0;
+        }
+
+        if (name == "deterministic")
+        {
+            return 1;
+        }
+
+        if (name == "opportunistic")
+        {
+            return -1;
+        }
+
+        throw std::invalid_argument("Parallel mode must be auto, deterministic or opportunistic: " + name);
+    }
+
+    /**
+     * @brief Node file strategy of cplex by name
+     *
+     * @param name is none, memory (compressed in memory), disk or disk-compressed
+     * @return int with the value of the cplex parameter
+     */
+    inline int node_file(const std::string &name)
+    {
+        const std::string names[] = {"none", "memory", "disk", "disk-compressed"};
+
+        for (int i = 0; i < 4; i++)
+        {
+            if (name == names[i])
+            {
+                return i;
+            }
+        }
+
+        throw std::invalid_argument("Node file must be none, memory, disk or disk-compressed: " + name);
+    }
+
+    /**
+     * @brief LP algorithm of cplex by name
+     *
+     * @param name is auto, primal, dual, network, barrier, sifting or concurrent
+     * @return int with the value of the cplex parameter
+     */
+    inline int lp_method(const std::string &name)
+    {
+        const std::string names[] = {"auto", "primal", "dual", "network", "barrier", "sifting", "concurrent"};
+
+        for (int i = 0; i < 7; i++)
+        {
+            if (name == names[i])
+            {
+                return i;
+            }
+        }
+
+        throw std::invalid_argument("LP method must be auto, primal, dual, network, barrier, sifting or concurrent: " + name);
+    }
+} // namespace solver_params
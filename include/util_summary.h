@@ -0,0 +1,367 @@
+#pragma once
+
+#include <string>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+
+#include "util_perf.h"
+
+/**
+ * @brief Machine readable summary of one run (a model solved for an instance and a number of trees)
+ *
+ */
+struct RunSummary
+{
+    std::string time_now;
+    std::string instance;
+    int n = 0;
+    std::string model;
+    int number_trees = 0;
+    bool relaxed = false;
+
+    double build_time = 0;
+    double solve_time = 0;
+
+    std::string status = "Unknown";
+    double objective = std::numeric_limits<double>::quiet_NaN();
+    double best_bound = std::numeric_limits<double>::quiet_NaN();
+    double gap = std::numeric_limits<double>::quiet_NaN();
+    long nodes = 0;
+
+    long rows = 0;
+    long cols = 0;
+    long nonzeros = 0;
+
+    // -1 if the solution was not checked (relaxed or without solution), 0 invalid and 1 valid
+    int valid = -1;
+
+    // label given by the caller to find the run on the table (used by the experiment runner)
+    std::string run_id;
+
+    // peak resident memory of the process and the resources of each phase (see perf::PhaseRecorder)
+    double peak_rss_mb = 0;
+    std::array<perf::PhaseMetrics, perf::number_phases> phases;
+
+    // variables fixed before the solve (by the reduced costs of the root relaxation)
+    long fixed = 0;
+};
+
+namespace summary
+{
+    /**
+     * @brief Header of the csv results table
+     *
+     * @return std::string with the name of the columns separated by commas
+     */
+    inline std::string csv_header()
+    {
+        std::string header = "time_now,instance,n,model,K,relaxed,build_time,solve_time,status,objective,best_bound,gap,nodes,rows,cols,nonzeros,valid,run_id,peak_rss_mb";
+
+        for (int p = 0; p < perf::number_phases; p++)
+        {
+            auto name = perf::phase_name((perf::Phase)p);
+            header += "," + name + "_time," + name + "_rss_mb," + name + "_heap_mb";
+        }
+
+        return header + ",fixed";
+    }
+
+    /**
+     * @brief Quote a csv field if it contains a separator or a quote
+     *
+     * @param field is the value of the field
+     * @return std::string
+     */
+    inline std::string csv_field(const std::string &field)
+    {
+        if (field.find_first_of(",\"\n") == std::string::npos)
+        {
+            return field;
+        }
+
+        std::string quoted = "\"";
+        for (auto &c : field)
+        {
+            if (c == '"')
+            {
+                quoted += '"';
+            }
+            quoted += c;
+        }
+        quoted += '"';
+
+        return quoted;
+    }
+
+    /**
+     * @brief Escape a string to be used as a json value
+     *
+     * @param field is the value of the field
+     * @return std::string
+     */
+    inline std::string json_string(const std::string &field)
+    {
+        std::string escaped = "\"";
+        for (auto &c : field)
+        {
+            if (c == '"' || c == '\\')
+            {
+                escaped += '\\';
+            }
+
+            if (c == '\n')
+            {
+                escaped += "\\n";
+            }
+            else
+            {
+                escaped += c;
+            }
+        }
+        escaped += '"';
+
+        return escaped;
+    }
+
+    /**
+     * @brief Write a number with full precision (json has no nan, so it is written as null)
+     *
+     * @param value is the number
+     * @param nan_value is the text used when value is not a number
+     * @return std::string
+     */
+    inline std::string number(double value, std::string nan_value)
+    {
+        if (value != value)
+        {
+            return nan_value;
+        }
+
+        std::ostringstream out;
+        out << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+
+        return out.str();
+    }
+
+    /**
+     * @brief One row of the csv results table (without the line break)
+     *
+     * @param s is the summary of the run
+     * @return std::string
+     */
+    inline std::string to_csv(const RunSummary &s)
+    {
+        std::ostringstream out;
+
+        out << csv_field(s.time_now) << "," << csv_field(s.instance) << "," << s.n << ","
+            << csv_field(s.model) << "," << s.number_trees << "," << (s.relaxed ? 1 : 0) << ","
+            << number(s.build_time, "") << "," << number(s.solve_time, "") << ","
+            << csv_field(s.status) << "," << number(s.objective, "") << "," << number(s.best_bound, "") << ","
+            << number(s.gap, "") << "," << s.nodes << "," << s.rows << "," << s.cols << "," << s.nonzeros << ","
+            << s.valid << "," << csv_field(s.run_id) << "," << number(s.peak_rss_mb, "");
+
+        for (auto &phase : s.phases)
+        {
+            out << "," << number(phase.time, "") << "," << number(phase.peak_rss_mb, "") << "," << number(phase.heap_mb, "");
+        }
+
+        out << "," << s.fixed;
+
+        return out.str();
+    }
+
+    /**
+     * @brief The summary as a json object in a single line
+     *
+     * @param s is the summary of the run
+     * @return std::string
+     */
+    inline std::string to_json(const RunSummary &s)
+    {
+        std::ostringstream out;
+
+        out << "{\"time_now\": " << json_string(s.time_now)
+            << ", \"instance\": " << json_string(s.instance)
+            << ", \"n\": " << s.n
+            << ", \"model\": " << json_string(s.model)
+            << ", \"K\": " << s.number_trees
+            << ", \"relaxed\": " << (s.relaxed ? "true" : "false")
+            << ", \"build_time\": " << number(s.build_time, "null")
+            << ", \"solve_time\": " << number(s.solve_time, "null")
+            << ", \"status\": " << json_string(s.status)
+            << ", \"objective\": " << number(s.objective, "null")
+            << ", \"best_bound\": " << number(s.best_bound, "null")
+            << ", \"gap\": " << number(s.gap, "null")
+            << ", \"nodes\": " << s.nodes
+            << ", \"rows\": " << s.rows
+            << ", \"cols\": " << s.cols
+            << ", \"nonzeros\": " << s.nonzeros
+            << ", \"valid\": " << (s.valid < 0 ? "null" : (s.valid == 1 ? "true" : "false"))
+            << ", \"run_id\": " << json_string(s.run_id)
+            << ", \"peak_rss_mb\": " << number(s.peak_rss_mb, "null")
+            << ", \"phases\": {";
+
+        for (int p = 0; p < perf::number_phases; p++)
+        {
+            auto &phase = s.phases[p];
+
+            out << (p > 0 ? ", " : "") << json_string(perf::phase_name((perf::Phase)p))
+                << ": {\"time\": " << number(phase.time, "null")
+                << ", \"rss_mb\": " << number(phase.peak_rss_mb, "null")
+                << ", \"heap_mb\": " << number(phase.heap_mb, "null") << "}";
+        }
+
+        out << "}, \"fixed\": " << s.fixed << "}";
+
+        return out.str();
+    }
+
+    /**
+     * @brief Set the peak memory of the process and the resources of the recorded phases on the
+     * summary (the running phase is stopped)
+     *
+     * @param s is the summary of the run
+     * @param phases are the phases of the run
+     */
+    inline void add_resources(RunSummary &s, perf::PhaseRecorder &phases)
+    {
+        phases.stop();
+
+        s.phases = phases.metrics;
+        s.peak_rss_mb = perf::memory::peak_rss_mb();
+    }
+
+    /**
+     * @brief First line of an open file (without the line break)
+     *
+     * @param fd is the file descriptor, opened for reading
+     * @return std::string
+     */
+    inline std::string first_line(int fd)
+    {
+        std::string line;
+        char buffer[4096];
+
+        lseek(fd, 0, SEEK_SET);
+
+        for (ssize_t count = read(fd, buffer, sizeof(buffer)); count > 0; count = read(fd, buffer, sizeof(buffer)))
+        {
+            auto end = std::find(buffer, buffer + count, '\n');
+            line.append(buffer, end);
+
+            if (end != buffer + count)
+            {
+                break;
+            }
+        }
+
+        return line;
+    }
+
+    /**
+     * @brief Append the summary to a results table. The format is json lines if the path ends
+     * with .jsonl, csv otherwise (the header is written when the file is empty, and a table
+     * with other columns, e.g. written by an older version, is not appended).
+     * The file is locked and the row is written with a single call, so concurrent runs
+     * can share the same table.
+     *
+     * @param path is the path of the results table
+     * @param s is the summary of the run
+     */
+    inline void append(const std::string &path, const RunSummary &s)
+    {
+        bool is_json = (path.size() >= 6) && (path.compare(path.size() - 6, 6, ".jsonl") == 0);
+
+        int fd = open(path.c_str(), O_RDWR | O_APPEND | O_CREAT, 0644);
+
+        if (fd < 0)
+        {
+            throw std::runtime_error("Could not open the results table " + path);
+        }
+
+        flock(fd, LOCK_EX);
+
+        std::string rows;
+
+        if (!is_json && lseek(fd, 0, SEEK_END) == 0)
+        {
+            rows += csv_header() + "\n";
+        }
+        else if (!is_json && first_line(fd) != csv_header())
+        {
+            flock(fd, LOCK_UN);
+            close(fd);
+
+            throw std::runtime_error("The results table " + path + " has other columns, write the summary on a new table");
+        }
+
+        rows += (is_json ? to_json(s) : to_csv(s)) + "\n";
+
+        auto written = write(fd, rows.c_str(), rows.size());
+
+        flock(fd, LOCK_UN);
+        close(fd);
+
+        if (written != (ssize_t)rows.size())
+        {
+            throw std::runtime_error("Could not write on the results table " + path);
+        }
+    }
+
+    /**
+     * @brief Split a row of the csv results table, the inverse of csv_field
+     *
+     * @param line is the row without the line break
+     * @return std::vector<std::string> with the values of the fields
+     */
+    inline std::vector<std::string> split_csv_row(const std::string &line)
+    {
+        std::vector<std::string> fields(1);
+        bool quoted = false;
+
+        for (size_t i = 0; i < line.size(); i++)
+        {
+            char c = line[i];
+
+            if (quoted)
+            {
+                if (c == '"' && i + 1 < line.size() && line[i + 1] == '"')
+                {
+                    fields.back() += '"';
+                    i++;
+                }
+                else if (c == '"')
+                {
+                    quoted = false;
+                }
+                else
+                {
+                    fields.back() += c;
+                }
+            }
+            else if (c == '"')
+            {
+                quoted = true;
+            }
+            else if (c == ',')
+            {
+                fields.push_back("");
+            }
+            else
+            {
+                fields.back() += c;
+            }
+        }
+
+        return fields;
+    }
+} // namespace summary
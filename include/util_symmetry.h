@@ -0,0 +1,101 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Break the symmetry of the interchangeable sinks: any permutation of the trees of a
+ * solution is a solution with the same value, so only the solutions whose trees are ordered
+ * by their smallest node are kept. The order is given by keys e[k][v] of the formulation,
+ * 1 if the node v is on the tree k (Tree) or is a root of the tree k (Root), and is imposed by
+ *
+ *     e[k][v] <= sum_{u < v} e[k - 1][u]    for k = 1, ..., K - 1 and every node v
+ *
+ * that is, the tree k - 1 has a node smaller than every node of the tree k (the empty trees
+ * are the last ones).
+ *
+ */
+namespace symmetry
+{
+    enum class Ordering
+    {
+        Formulation, // the rows of the formulation, if any (test_5 of FlowModel3, MAR, weight-as-flow and FlowModel2-1-sbc)
+        None,        // the trees are not ordered
+        Root,        // by the smallest root of each tree (the arcs of the sinks)
+        Tree         // by the smallest node of each tree (the per sink assignment of the nodes)
+    };
+
+    /**
+     * @brief Ordering from its name
+     *
+     * @param name is none, root or tree
+     * @return Ordering
+     */
+    inline Ordering ordering(const std::string &name)
+    {
+        const std::vector<std::string> names = {"none", "root", "tree"};
+
+        auto found = std::find(names.begin(), names.end(), name);
+
+        if (found == names.end())
+        {
+            throw std::invalid_argument("Unknown symmetry ordering " + name + " (none | root | tree)");
+        }
+
+        return (Ordering)(1 + (found - names.begin()));
+    }
+
+    /**
+     * @brief Name of an ordering
+     *
+     * @param ordering is the ordering
+     * @return std::string
+     */
+    inline std::string ordering_name(Ordering ordering)
+    {
+        const std::string names[4] = {"formulation", "none", "root", "tree"};
+
+        return names[(int)ordering];
+    }
+
+    struct Row
+    {
+        int tree;         // k of e[k][v] <= sum_{u < v} e[k - 1][u]
+        int node;         // v
+        double violation; // e[k][v] - sum_{u < v} e[k - 1][u]
+    };
+
+    /**
+     * @brief Rows of the order violated by a point, the most violated first
+     *
+     * @param keys are the values of the keys e[k][v] on the point
+     * @param tolerance is the smallest violation reported
+     * @return std::vector<Row>
+     */
+    inline std::vector<Row> violated_rows(const std::vector<std::vector<double>> &keys, double tolerance = 1e-6)
+    {
+        std::vector<Row> violated;
+
+        for (int k = 1; k < (int)keys.size(); k++)
+        {
+            double smaller = 0;
+
+            for (int v = 0; v < (int)keys[k].size(); v++)
+            {
+                if (keys[k][v] - smaller > tolerance)
+                {
+                    violated.push_back({k, v, keys[k][v] - smaller});
+                }
+
+                smaller += keys[k - 1][v];
+            }
+        }
+
+        std::stable_sort(violated.begin(), violated.end(), [](const Row &a, const Row &b)
+                         { return a.violation > b.violation; });
+
+        return violated;
+    }
+} // namespace symmetry
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <ilcplex/ilocplex.h>
+
+#include <atomic>
+
+#include "util_symmetry.h"
+
+/**
+ * @brief Generic callback that imposes the order of the trees by branching instead of rows: when
+ * the relaxation of a node violates the order, the node gets a single child with the most
+ * violated row. The row is local to the subtree of the node, so the model and the nodes that
+ * do not need it keep the relaxation without the K * n rows. The ordered solutions of a node
+ * are kept on its child, so the optimal ordered solution is never cut off.
+ *
+ */
+class SymmetryBrancher : public IloCplex::Callback::Function
+{
+public:
+    // set the keys of the order (see symmetry namespace), the brancher is active once they are set
+    void set_keys(IloArray<IloExprArray> keys);
+
+    // true if the keys were set
+    bool active();
+
+    void invoke(const IloCplex::Callback::Context &context) override;
+
+    // number of nodes branched by the order
+    int number_of_branches();
+
+private:
+    IloArray<IloExprArray> keys;
+    bool has_keys = false;
+
+    std::atomic<int> branches{0};
+
+    IloRange create_row(IloEnv env, const symmetry::Row &row);
+};
+
+inline void SymmetryBrancher::set_keys(IloArray<IloExprArray> keys)
+{
+    this->keys = keys;
+    has_keys = true;
+}
+
+inline bool SymmetryBrancher::active()
+{
+    return has_keys;
+}
+
+inline int SymmetryBrancher::number_of_branches()
+{
+    return branches;
+}
+
+inline void SymmetryBrancher::invoke(const IloCplex::Callback::Context &context)
+{
+    if (!context.inBranching())
+    {
+        return;
+    }
+
+    std::vector<std::vector<double>> values(keys.getSize());
+
+    for (int k = 0; k < keys.getSize(); k++)
+    {
+        values[k].resize(keys[k].getSize());
+
+        for (int v = 0; v < keys[k].getSize(); v++)
+        {
+            values[k][v] = context.getRelaxationPoint(keys[k][v]);
+        }
+    }
+
+    auto violated = symmetry::violated_rows(values);
+
+    // without a branch cplex branches as usual
+    if (violated.empty())
+    {
+        return;
+    }
+
+    IloRange row = create_row(context.getEnv(), violated.front());
+
+    context.makeBranch(row, context.getRelaxationObjective());
+    branches++;
+
+    row.end();
+}
+
+inline IloRange SymmetryBrancher::create_row(IloEnv env, const symmetry::Row &row)
+{
+    IloExpr expr(env);
+
+    expr += keys[row.tree][row.node];
+
+    for (int u = 0; u < row.node; u++)
+    {
+        expr -= keys[row.tree - 1][u];
+    }
+
+    IloRange range(env, -IloInfinity, expr, 0);
+    expr.end();
+
+    return range;
+}
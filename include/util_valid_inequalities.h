@@ -0,0 +1,170 @@
+#pragma once
+
+#include <vector>
+#include <set>
+#include <mutex>
+#include <tuple>
+
+#include "wsn_data.h"
+#include "util_arc_values.h"
+
+namespace valid_inequalities
+{
+    // families of valid inequalities of CastroAndrade2023 (numbered as in the paper)
+    enum Family
+    {
+        CastroAndrade2023_10, // sum x(u)(v) + sum x(v)(l) - (y(u) + z(u)) - sum (y(v) + z(v)) <= -1, v in N(u), l in N(v) and N[u]
+        CastroAndrade2023_12, // 2 z(i) <= sum x(i)(j) + x(j)(i)
+        CastroAndrade2023_15, // x(i)(j) + x(j)(i) <= y(i) + z(i)
+        CastroAndrade2023_16, // x(i)(j) <= z(i) + z(j)
+        CastroAndrade2023_17  // x(i)(j) <= y(i) + y(j)
+    };
+
+    /**
+     * @brief An inequality of a family, identified by its nodes (j is -1 when the inequality has one node)
+     *
+     */
+    struct Inequality
+    {
+        Family family;
+        int i;
+        int j;
+
+        bool operator<(const Inequality &other) const
+        {
+            return std::tie(family, i, j) < std::tie(other.family, other.i, other.j);
+        }
+
+        bool operator==(const Inequality &other) const
+        {
+            return family == other.family && i == other.i && j == other.j;
+        }
+    };
+
+    /**
+     * @brief Find the inequalities of CastroAndrade2023 violated by a (fractional) solution
+     *
+     * @param instance is the problem instance
+     * @param families are the families to be checked
+     * @param x is the value of the arcs between nodes
+     * @param y is the value of the masters
+     * @param z is the value of the bridges
+     * @param tolerance is the minimum violation
+     * @return std::vector<Inequality> with the violated inequalities
+     */
+    inline std::vector<Inequality> violated_castro_andrade2023(WSN_data &instance,
+                                                        const std::vector<Family> &families,
+                                                        const ArcValues &x,
+                                                        const std::vector<double> &y,
+                                                        const std::vector<double> &z,
+                                                        double tolerance = 1e-4)
+    {
+        std::vector<Inequality> violated;
+        std::set<Family> check(families.begin(), families.end());
+
+        auto checked = [&](Family family)
+        {
+            return check.find(family) != check.end();
+        };
+
+        for (int i = 0; i < instance.n; i++)
+        {
+            double arcs = 0;
+
+            for (int p = 0; p < x.degree(i); p++)
+            {
+                int j = x.head(i, p);
+                int back = x.reverse(i, p);
+
+                double x_ij = x.at(i, p);
+                double x_ji = (back < 0) ? 0.0 : x.at(j, back);
+
+                arcs += x_ij + x_ji;
+
+                if (checked(CastroAndrade2023_15) && x_ij + x_ji > y[i] + z[i] + tolerance)
+                {
+                    violated.push_back({CastroAndrade2023_15, i, j});
+                }
+
+                if (checked(CastroAndrade2023_16) && x_ij > z[i] + z[j] + tolerance)
+                {
+                    violated.push_back({CastroAndrade2023_16, i, j});
+                }
+
+                if (checked(CastroAndrade2023_17) && x_ij > y[i] + y[j] + tolerance)
+                {
+                    violated.push_back({CastroAndrade2023_17, i, j});
+                }
+            }
+
+            if (checked(CastroAndrade2023_12) && 2 * z[i] > arcs + tolerance)
+            {
+                violated.push_back({CastroAndrade2023_12, i, -1});
+            }
+        }
+
+        if (checked(CastroAndrade2023_10))
+        {
+            for (int u = 0; u < instance.n; u++)
+            {
+                std::set<int> neighbors(instance.adj_list_from_v[u]);
+                neighbors.insert(u); // neighbors = N[u]
+
+                double lhs = -(y[u] + z[u]);
+
+                for (int p = 0; p < x.degree(u); p++)
+                {
+                    int v = x.head(u, p);
+
+                    lhs += x.at(u, p) - (y[v] + z[v]);
+
+                    for (int q = 0; q < x.degree(v); q++)
+                    {
+                        if (neighbors.find(x.head(v, q)) != neighbors.end())
+                        {
+                            lhs += x.at(v, q);
+                        }
+                    }
+                }
+
+                if (lhs > -1 + tolerance)
+                {
+                    violated.push_back({CastroAndrade2023_10, u, -1});
+                }
+            }
+        }
+
+        return violated;
+    }
+
+    /**
+     * @brief Inequalities already added to the model, shared by the threads of the solver
+     *
+     */
+    class InequalityPool
+    {
+    public:
+        // returns true if the inequality was not in the pool
+        bool insert(const Inequality &inequality);
+
+        int size();
+
+    private:
+        std::set<Inequality> pool;
+        std::mutex pool_lock;
+    };
+
+    inline bool InequalityPool::insert(const Inequality &inequality)
+    {
+        std::lock_guard<std::mutex> guard(pool_lock);
+
+        return pool.insert(inequality).second;
+    }
+
+    inline int InequalityPool::size()
+    {
+        std::lock_guard<std::mutex> guard(pool_lock);
+
+        return pool.size();
+    }
+} // namespace valid_inequalities
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <ilcplex/ilocplex.h>
+
+#include "util_valid_inequalities.h"
+
+/**
+ * @brief Generic callback that separates the valid inequalities of CastroAndrade2023 on the
+ * relaxation of each node, instead of adding all of them to the model. The inequalities are
+ * global and never purged, so a pool avoids adding the same inequality twice.
+ *
+ */
+class CastroAndrade2023Separator : public IloCplex::Callback::Function
+{
+public:
+    CastroAndrade2023Separator(WSN_data &instance, IloArray<IloNumVarArray> x, IloNumVarArray y, IloNumVarArray z,
+                               std::vector<valid_inequalities::Family> families);
+
+    void invoke(const IloCplex::Callback::Context &context) override;
+
+    // number of inequalities added to the model
+    int number_of_cuts();
+
+private:
+    WSN_data &instance;
+    IloArray<IloNumVarArray> x;
+    IloNumVarArray y;
+    IloNumVarArray z;
+    std::vector<valid_inequalities::Family> families;
+
+    valid_inequalities::InequalityPool pool;
+
+    IloRange create_cut(IloEnv env, const valid_inequalities::Inequality &inequality);
+};
+
+inline CastroAndrade2023Separator::CastroAndrade2023Separator(WSN_data &instance, IloArray<IloNumVarArray> x,
+                                                       IloNumVarArray y, IloNumVarArray z,
+                                                       std::vector<valid_inequalities::Family> families) : instance(instance), x(x), y(y), z(z),
+                                                                                                           families(families)
+{
+}
+
+inline void CastroAndrade2023Separator::invoke(const IloCplex::Callback::Context &context)
+{
+    if (!context.inRelaxation())
+    {
+        return;
+    }
+
+    ArcValues x_value(instance);
+    std::vector<double> y_value(instance.n);
+    std::vector<double> z_value(instance.n);
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (int p = 0; p < x_value.degree(i); p++)
+        {
+            x_value.at(i, p) = context.getRelaxationPoint(x[i][x_value.head(i, p)]);
+        }
+
+        y_value[i] = context.getRelaxationPoint(y[i]);
+        z_value[i] = context.getRelaxationPoint(z[i]);
+    }
+
+    auto violated = valid_inequalities::violated_castro_andrade2023(instance, families, x_value, y_value, z_value);
+
+    IloEnv env = context.getEnv();
+
+    for (auto &inequality : violated)
+    {
+        if (!pool.insert(inequality))
+        {
+            continue;
+        }
+
+        IloRange cut = create_cut(env, inequality);
+
+        context.addUserCut(cut, IloCplex::UseCutForce, IloFalse);
+
+        cut.end();
+    }
+}
+
+inline int CastroAndrade2023Separator::number_of_cuts()
+{
+    return pool.size();
+}
+
+inline IloRange CastroAndrade2023Separator::create_cut(IloEnv env, const valid_inequalities::Inequality &inequality)
+{
+    int i = inequality.i;
+    int j = inequality.j;
+
+    IloExpr expr(env);
+    IloRange cut;
+
+    switch (inequality.family)
+    {
+    case valid_inequalities::CastroAndrade2023_10:
+    {
+        std::set<int> neighbors(instance.adj_list_from_v[i]);
+        neighbors.insert(i); // neighbors = N[u]
+
+        expr -= (y[i] + z[i]);
+        for (auto &v : instance.adj_list_from_v[i])
+        {
+            expr += x[i][v];
+            expr -= (y[v] + z[v]);
+
+            for (auto &l : instance.adj_list_from_v[v])
+            {
+                if (neighbors.find(l) != neighbors.end())
+                {
+                    expr += x[v][l];
+                }
+            }
+        }
+
+        cut = (expr <= -1);
+        break;
+    }
+    case valid_inequalities::CastroAndrade2023_12:
+        for (auto &to : instance.adj_list_from_v[i])
+        {
+            expr += (x[i][to] + x[to][i]);
+        }
+
+        cut = (2 * z[i] <= expr);
+        break;
+    case valid_inequalities::CastroAndrade2023_15:
+        cut = ((x[i][j] + x[j][i]) <= y[i] + z[i]);
+        break;
+    case valid_inequalities::CastroAndrade2023_16:
+        cut = (x[i][j] <= z[i] + z[j]);
+        break;
+    case valid_inequalities::CastroAndrade2023_17:
+        cut = (x[i][j] <= y[i] + y[j]);
+        break;
+    }
+
+    expr.end();
+
+    return cut;
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <iostream>
+#include <stdexcept>
+
+#include "all_models.h"
+#include "experiment_runner.h"
+#include "util_model_size.h"
+
+/**
+ * @brief Solve a list of jobs (model, K, relaxed) on an instance read once, inside one process.
+ * Each job creates only its model, on its own IloEnv, which is ended when the job finishes (a
+ * Concert environment is not thread safe, so jobs solved at the same time can not share one).
+ * Each job uses its own copy of the instance, since the number of trees is set on it.
+ *
+ */
+class WSN_batch
+{
+public:
+    WSN_batch(WSN_data &instance, double upper_bound, std::string summary_path);
+
+    /**
+     * @brief Solve the jobs
+     *
+     * @param jobs are the jobs, solved in this order
+     * @param workers is the number of jobs solved at the same time, the cores are split among them
+     * @return std::vector<RunSummary> with the summary of each job (status Error if it failed)
+     */
+    std::vector<RunSummary> solve(const std::vector<experiment::Job> &jobs, int workers = 1);
+
+    bool use_lower_bounds = false;    // bound T by the combinatorial lower bounds on each job
+    SolverParams solver_params;       // parameters of cplex on each job
+    double memory_budget = 0;         // MB of each model, jobs whose estimate exceeds it are not built (0 for none)
+    bool fast_relaxed = false;        // relaxed jobs without the .relaxed.lp export and the values on .relaxed.sol
+    bool reduced_cost_fixing = false; // fix variables by the reduced costs of the root relaxation on the mip jobs
+
+    symmetry::Ordering symmetry = symmetry::Ordering::Formulation; // order of the trees on each job
+    bool symmetry_branching = false;                               // impose the order by branching instead of rows
+
+private:
+    WSN_data &instance;
+    double upper_bound;
+    std::string summary_path;
+
+    std::mutex output_lock;
+
+    RunSummary solve_job(const experiment::Job &job, int threads);
+};
+
+inline WSN_batch::WSN_batch(WSN_data &instance, double upper_bound,
+                     std::string summary_path) : instance(instance),
+                                                 upper_bound(upper_bound),
+                                                 summary_path(summary_path)
+{
+}
+
+inline std::vector<RunSummary> WSN_batch::solve(const std::vector<experiment::Job> &jobs, int workers)
+{
+    std::vector<RunSummary> runs(jobs.size());
+
+    workers = std::max(1, std::min(workers, (int)jobs.size()));
+
+    // without a number of threads, a single worker lets cplex use every core and more workers split them
+    int threads = solver_params.threads;
+
+    if (threads == 0 && workers > 1)
+    {
+        threads = std::max(1, (int)std::thread::hardware_concurrency() / workers);
+    }
+
+    std::atomic<int> next_job(0);
+    std::vector<std::thread> threads_of_workers;
+
+    for (int w = 0; w < workers; w++)
+    {
+        threads_of_workers.push_back(std::thread([&]()
+                                                 {
+                                                     for (int j = next_job++; j < (int)jobs.size(); j = next_job++)
+                                                     {
+                                                         runs[j] = solve_job(jobs[j], threads);
+                                                     } }));
+    }
+
+    for (auto &thread : threads_of_workers)
+    {
+        thread.join();
+    }
+
+    std::cout << "jobs: " << jobs.size() << std::endl;
+    for (int j = 0; j < (int)jobs.size(); j++)
+    {
+        std::cout << jobs[j].model << " | K: " << jobs[j].number_trees << (jobs[j].relaxed ? " | relaxed" : "")
+                  << " | " << runs[j].status << " | obj: " << runs[j].objective
+                  << " | time: " << runs[j].build_time + runs[j].solve_time << std::endl;
+    }
+
+    return runs;
+}
+
+inline RunSummary WSN_batch::solve_job(const experiment::Job &job, int threads)
+{
+    RunSummary run;
+    run.instance = instance.name();
+    run.n = instance.n;
+    run.model = job.model;
+    run.number_trees = job.number_trees;
+    run.relaxed = job.relaxed;
+    run.status = "Error";
+
+    WSN_data job_instance = instance;
+    job_instance.set_number_trees(job.number_trees);
+
+    std::unique_ptr<WSN> model;
+
+    try
+    {
+        check_model_name(job.model);
+
+        if (!model_size::fits(model_size::estimate(job.model, job_instance), memory_budget))
+        {
+            run = model_size::over_budget_run(job.model, job_instance, job.relaxed);
+            run.time_now = print::time_now();
+            run.peak_rss_mb = perf::memory::peak_rss_mb();
+            summary::append(summary_path, run);
+
+            return run;
+        }
+
+        model = create_model(job.model, job_instance, upper_bound);
+
+        (*model).summary_path = summary_path;
+        (*model).solver_params = solver_params;
+        (*model).solver_params.threads = threads;
+        (*model).use_lower_bounds = use_lower_bounds;
+        (*model).fast_relaxed = fast_relaxed;
+        (*model).reduced_cost_fixing = reduced_cost_fixing;
+        (*model).symmetry = symmetry;
+        (*model).symmetry_branching = symmetry_branching;
+        (*model).check_model_options();
+
+        (*model).solve(job.relaxed);
+
+        run = (*model).last_run;
+    }
+    catch (std::exception &e)
+    {
+        std::lock_guard<std::mutex> guard(output_lock);
+        std::cerr << job.model << " with " << job.number_trees << " trees: " << e.what() << std::endl;
+    }
+    catch (IloException &e)
+    {
+        std::lock_guard<std::mutex> guard(output_lock);
+        std::cerr << job.model << " with " << job.number_trees << " trees: " << e << std::endl;
+    }
+
+    // frees the model, its cplex and everything extracted before the next job
+    if (model != nullptr)
+    {
+        (*model).env.end();
+    }
+
+    return run;
+}
@@ -0,0 +1,250 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <iostream>
+#include <stdexcept>
+
+#include "all_models.h"
+#include "wsn_preprocessing.h"
+#include "util_decomposition.h"
+#include "util_lower_bounds.h"
+
+/**
+ * @brief Solve an instance by its connected components. Each component must have at least one
+ * tree, so every component is solved for each number of trees it may receive (in parallel, each
+ * solve using one cplex thread) and the trees are distributed by a min-max dynamic program.
+ *
+ */
+class WSN_decomposition
+{
+public:
+    WSN_decomposition(WSN_data &instance, std::string model_name, double upper_bound, std::string summary_path);
+
+    /**
+     * @brief Solve the components and combine the results
+     *
+     * @param relaxed if true the linear relaxation of each component is solved (the result is a lower bound)
+     * @param workers is the number of components solved at the same time (0 uses the number of cores)
+     */
+    void solve(bool relaxed, int workers = 0);
+
+    std::string run_id;         // label of the runs on the results table (see RunSummary)
+    SolverParams solver_params; // parameters of cplex on each component (with one thread)
+    perf::PhaseRecorder phases; // time and memory of the run (the components are on the solve phase)
+
+private:
+    WSN_data &instance;
+    std::string model_name;
+    double upper_bound;
+    std::string summary_path;
+
+    std::vector<std::vector<int>> components;
+
+    // best solution value and best bound of each component for each number of trees
+    std::vector<std::vector<double>> objective;
+    std::vector<std::vector<double>> best_bound;
+
+    std::mutex output_lock;
+
+    void solve_component(int component, int number_trees, bool relaxed);
+};
+
+inline WSN_decomposition::WSN_decomposition(WSN_data &instance, std::string model_name,
+                                     double upper_bound, std::string summary_path) : instance(instance),
+                                                                                     model_name(model_name),
+                                                                                     upper_bound(upper_bound),
+                                                                                     summary_path(summary_path),
+                                                                                     components(instance.connected_components())
+{
+    if ((int)components.size() > instance.number_trees)
+    {
+        throw std::invalid_argument("Infeasible instance: it has " + std::to_string(components.size()) +
+                                    " connected components and only " + std::to_string(instance.number_trees) + " trees");
+    }
+}
+
+inline void WSN_decomposition::solve(bool relaxed, int workers)
+{
+    const double infinity = std::numeric_limits<double>::infinity();
+    int number_components = components.size();
+
+    // a component receives at most its number of nodes, and the others at least one tree
+    std::vector<int> max_trees(number_components);
+    int total_max_trees = 0;
+
+    for (int c = 0; c < number_components; c++)
+    {
+        max_trees[c] = std::min((int)components[c].size(), instance.number_trees - number_components + 1);
+        total_max_trees += max_trees[c];
+    }
+
+    std::vector<std::pair<int, int>> tasks;
+
+    objective = std::vector<std::vector<double>>(number_components);
+    best_bound = std::vector<std::vector<double>>(number_components);
+
+    for (int c = 0; c < number_components; c++)
+    {
+        // the trees that the other components can not receive
+        int min_trees = std::max(1, instance.number_trees - (total_max_trees - max_trees[c]));
+
+        objective[c] = std::vector<double>(max_trees[c] + 1, infinity);
+        best_bound[c] = std::vector<double>(max_trees[c] + 1, infinity);
+
+        // a bound is only infinity when the component is proved infeasible, so the dual
+        // allocation never skips a number of trees that was not solved
+        for (int k = min_trees; k <= max_trees[c]; k++)
+        {
+            best_bound[c][k] = 0;
+            tasks.push_back({c, k});
+        }
+    }
+
+    if (workers <= 0)
+    {
+        workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    auto start = perf::time::start();
+    phases.start(perf::Phase::Solve);
+
+    std::atomic<int> next_task(0);
+    std::vector<std::thread> threads;
+
+    for (int w = 0; w < std::min(workers, (int)tasks.size()); w++)
+    {
+        threads.push_back(std::thread([&]()
+                                      {
+                                          for (int t = next_task++; t < (int)tasks.size(); t = next_task++)
+                                          {
+                                              solve_component(tasks[t].first, tasks[t].second, relaxed);
+                                          } }));
+    }
+
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    double elapsed = perf::time::duration(start).count();
+
+    phases.start(perf::Phase::Output);
+    auto primal = decomposition::min_max_allocation(objective, instance.number_trees);
+    auto dual = decomposition::min_max_allocation(best_bound, instance.number_trees);
+
+    std::cout << "components: " << number_components << std::endl;
+    for (int c = 0; c < number_components; c++)
+    {
+        std::cout << "component " << c << " (n: " << components[c].size() << ")";
+        for (int k = 1; k < (int)objective[c].size(); k++)
+        {
+            std::cout << " | K=" << k << ": " << objective[c][k] << " [" << best_bound[c][k] << "]";
+        }
+        std::cout << std::endl;
+    }
+
+    std::cout << "trees by component:";
+    for (auto &trees : primal.trees)
+    {
+        std::cout << " " << trees;
+    }
+    std::cout << std::endl;
+
+    std::cout << "time: " << elapsed << std::endl;
+    std::cout << "obj: " << primal.value << std::endl;
+    std::cout << "best_obj: " << dual.value << std::endl;
+
+    RunSummary run;
+    run.time_now = print::time_now();
+    run.instance = instance.name();
+    run.n = instance.n;
+    run.model = model_name + "-decomposed";
+    run.number_trees = instance.number_trees;
+    run.relaxed = relaxed;
+    run.solve_time = elapsed;
+    run.status = (primal.value == infinity) ? "Infeasible" : "Decomposed";
+    run.run_id = run_id;
+    summary::add_resources(run, phases);
+
+    if (primal.value != infinity)
+    {
+        run.objective = primal.value;
+        run.best_bound = dual.value;
+        run.gap = (primal.value - dual.value) / (1e-10 + std::abs(primal.value));
+    }
+
+    summary::append(summary_path, run);
+}
+
+inline void WSN_decomposition::solve_component(int component, int number_trees, bool relaxed)
+{
+    auto &nodes = components[component];
+
+    // a component with one or two nodes has a single tree, with one master and weight zero
+    if (nodes.size() <= 2)
+    {
+        objective[component][number_trees] = (number_trees == 1) ? 0 : std::numeric_limits<double>::infinity();
+        best_bound[component][number_trees] = objective[component][number_trees];
+
+        return;
+    }
+
+    std::unique_ptr<WSN_data> sub_instance;
+    std::unique_ptr<WSN> model_of_component;
+
+    try
+    {
+        sub_instance = induced_instance(instance, nodes, number_trees, instance.name() + "_c" + std::to_string(component));
+
+        // kept if the solve fails or gives no bound
+        double combinatorial_bound = lower_bounds::combinatorial(*sub_instance).value();
+        best_bound[component][number_trees] = combinatorial_bound;
+
+        model_of_component = create_model(model_name, *sub_instance,
+                                          (upper_bound > 0) ? upper_bound : std::numeric_limits<double>::max());
+
+        auto &model = *model_of_component;
+        model.summary_path = decomposition::components_table(summary_path);
+        model.run_id = run_id;
+        model.solver_params = solver_params;
+        model.solver_params.threads = 1;
+
+        model.solve(relaxed);
+
+        auto &run = model.last_run;
+
+        // a component without solution (infeasible or time limit) keeps infinity as objective
+        if (run.objective == run.objective)
+        {
+            objective[component][number_trees] = run.objective;
+        }
+
+        if (run.status == "Infeasible")
+        {
+            best_bound[component][number_trees] = std::numeric_limits<double>::infinity();
+        }
+        else if (run.best_bound == run.best_bound)
+        {
+            best_bound[component][number_trees] = std::max(combinatorial_bound, run.best_bound);
+        }
+    }
+    catch (std::exception &e)
+    {
+        std::lock_guard<std::mutex> guard(output_lock);
+        std::cerr << "component " << component << " with " << number_trees << " trees: " << e.what() << std::endl;
+    }
+    catch (IloException &e)
+    {
+        std::lock_guard<std::mutex> guard(output_lock);
+        std::cerr << "component " << component << " with " << number_trees << " trees: " << e << std::endl;
+    }
+
+    if (model_of_component != nullptr)
+    {
+        (*model_of_component).env.end();
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <random>
+
+#include "util_instance.h"
+
+/**
+ * @brief Synthetic sensor networks: n sensors placed uniformly on a square area, with an edge between
+ * the sensors whose distance is at most the radio range (unit-disk graph). The generator depends only
+ * on std::mt19937_64 and on correctly rounded arithmetic, so the same parameters give bit-identical
+ * instances on every machine (the energy weights with a path loss other than 2 use std::pow).
+ */
+namespace generator
+{
+    enum class WeightModel
+    {
+        Distance, // euclidean distance
+        Energy    // transmission energy, distance ^ path_loss
+    };
+
+    struct GeometricParams
+    {
+        int n = 100;
+        double area = 100;  // side of the square
+        double range = 20;  // radio range
+        WeightModel weight = WeightModel::Distance;
+        double path_loss = 2; // exponent of the energy model
+        unsigned long long seed = 0;
+    };
+
+    struct SensorNetwork
+    {
+        int n = 0;
+        std::vector<std::pair<double, double>> position;
+        std::vector<WeightedEdge> edges; // from < to, sorted, weights rounded to two decimals
+    };
+
+    // uniform double on [0, 1) given by the 53 high bits of the generator (the same on every standard library)
+    double uniform(std::mt19937_64 &rng);
+
+    // parse the name of a weight model ("distance" or "energy")
+    WeightModel weight_model(const std::string &name);
+
+    /**
+     * @brief Generate a random geometric (unit-disk) sensor network
+     *
+     * @param params are the number of sensors, area, range, weight model and seed
+     * @return SensorNetwork with the positions and the edges
+     */
+    SensorNetwork random_geometric(const GeometricParams &params);
+
+    /**
+     * @brief Number of connected components of a network (each one needs at least one sink)
+     *
+     * @param network is the generated network
+     * @return int the number of components
+     */
+    int number_of_components(const SensorNetwork &network);
+
+    /**
+     * @brief Write the network on the MSCWSN text format (path.txt) and on the binary cache (path.wsnb)
+     *
+     * @param network is the generated network
+     * @param path is the path of the files without extension
+     */
+    void write_network(const SensorNetwork &network, const std::string &path);
+} // namespace generator
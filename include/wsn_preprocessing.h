@@ -0,0 +1,225 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <utility>
+#include <string>
+
+#include "wsn_data.h"
+
+/**
+ * @brief Create the instance induced by a subset of nodes
+ *
+ * @param instance is the original instance
+ * @param nodes are the nodes of the original instance kept, in the order of the new instance
+ * @param number_trees is the number of trees of the new instance
+ * @param name is the name of the new instance
+ * @return std::unique_ptr<WSN_data> is the induced instance
+ */
+inline std::unique_ptr<WSN_data> induced_instance(WSN_data &instance, const std::vector<int> &nodes, int number_trees, std::string name)
+{
+    int n = nodes.size();
+    std::vector<std::vector<double>> weight(n, std::vector<double>(n));
+    std::vector<std::vector<int>> is_connected(n, std::vector<int>(n));
+
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            weight[i][j] = instance.weight[nodes[i]][nodes[j]];
+            is_connected[i][j] = instance.is_connected[nodes[i]][nodes[j]];
+        }
+    }
+
+    auto induced = std::make_unique<WSN_data>(weight, is_connected, n, number_trees);
+    (*induced).set_instance_path(name);
+
+    return induced;
+}
+
+/**
+ * @brief Provable reductions of an instance, done before the model is built.
+ *
+ * - a connected component with one or two nodes has exactly one tree, with a single master
+ *   and weight zero, so it is removed and the number of trees is decreased (the max weight
+ *   of the other trees is not changed);
+ * - every arc joins a bridge and a master, and a bridge has arcs to two masters, which are not
+ *   adjacent; so a node i is a bridge between j and another master only if some neighbor of i
+ *   other than j is not adjacent to j;
+ * - a node that can not be a bridge between any pair of its neighbors (its neighbors are pairwise
+ *   adjacent, e.g. a leaf) is not a bridge (z = 0);
+ * - an arc whose ends can not be a bridge between each other is not used (x = 0 on both ways),
+ *   e.g. the arcs between two nodes of a clique that have no other neighbors.
+ *
+ * The fixings are given on the nodes of the reduced instance, and a solution of the reduced
+ * instance is lifted back to the original one.
+ */
+class WSN_reduction
+{
+public:
+    WSN_reduction(WSN_data &original);
+
+    WSN_data &original;
+
+    // the instance without the removed components
+    WSN_data &reduced_instance();
+
+    // true if some node was removed
+    bool is_reduced();
+
+    // node of the original instance of each node of the reduced instance
+    std::vector<int> original_node;
+
+    // masters of the removed components (nodes of the original instance)
+    std::vector<int> removed_masters;
+
+    // nodes of the reduced instance that can not be bridges
+    std::vector<int> not_bridge;
+
+    // arcs (from, to) of the reduced instance that are not used by any solution
+    std::vector<std::pair<int, int>> fixed_arcs;
+
+    /**
+     * @brief Map a solution of the reduced instance to a solution of the original one
+     *
+     * @param edges are the arcs {from, to} of the forest
+     * @param masters are the master nodes
+     * @param bridges are the bridge nodes
+     */
+    void lift(std::vector<std::vector<int>> &edges, std::vector<int> &masters, std::vector<int> &bridges);
+
+private:
+    std::unique_ptr<WSN_data> reduced;
+
+    void remove_trivial_components();
+    void find_fixings();
+
+    // true if i can be a bridge between j and another master (a neighbor of i that is not adjacent to j)
+    bool can_bridge(int i, int j);
+};
+
+inline WSN_reduction::WSN_reduction(WSN_data &original) : original(original)
+{
+    remove_trivial_components();
+    find_fixings();
+}
+
+inline WSN_data &WSN_reduction::reduced_instance()
+{
+    return *reduced;
+}
+
+inline bool WSN_reduction::is_reduced()
+{
+    return !removed_masters.empty();
+}
+
+inline void WSN_reduction::remove_trivial_components()
+{
+    auto components = original.connected_components();
+
+    std::vector<bool> removed(original.n, false);
+
+    for (auto &nodes : components)
+    {
+        // at least one tree must be left to the other components
+        bool trees_left = (original.number_trees - (int)removed_masters.size()) > 1;
+
+        if (nodes.size() <= 2 && trees_left && (int)nodes.size() < original.n)
+        {
+            removed_masters.push_back(nodes.front());
+
+            for (auto &node : nodes)
+            {
+                removed[node] = true;
+            }
+        }
+    }
+
+    for (int i = 0; i < original.n; i++)
+    {
+        if (!removed[i])
+        {
+            original_node.push_back(i);
+        }
+    }
+
+    reduced = induced_instance(original, original_node, original.number_trees - (int)removed_masters.size(),
+                               original.name() + (is_reduced() ? "_reduced" : ""));
+}
+
+inline void WSN_reduction::find_fixings()
+{
+    WSN_data &instance = *reduced;
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        bool bridge = false;
+
+        for (auto &j : instance.adj_list_from_v[i])
+        {
+            if (can_bridge(i, j))
+            {
+                bridge = true;
+                break;
+            }
+        }
+
+        if (!bridge)
+        {
+            not_bridge.push_back(i);
+        }
+    }
+
+    for (int i = 0; i < instance.n; i++)
+    {
+        for (auto &j : instance.adj_list_from_v[i])
+        {
+            if (!can_bridge(i, j) && !can_bridge(j, i))
+            {
+                fixed_arcs.push_back({i, j});
+            }
+        }
+    }
+}
+
+inline bool WSN_reduction::can_bridge(int i, int j)
+{
+    WSN_data &instance = *reduced;
+
+    for (auto &other : instance.adj_list_from_v[i])
+    {
+        if (other != j && instance.is_connected[other][j] == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+inline void WSN_reduction::lift(std::vector<std::vector<int>> &edges, std::vector<int> &masters, std::vector<int> &bridges)
+{
+    int reduced_n = original_node.size();
+
+    for (auto &edge : edges)
+    {
+        for (auto &node : edge)
+        {
+            // sinks are numbered after the nodes
+            node = (node < reduced_n) ? original_node[node] : original.n + (node - reduced_n);
+        }
+    }
+
+    for (auto &node : masters)
+    {
+        node = original_node[node];
+    }
+
+    for (auto &node : bridges)
+    {
+        node = original_node[node];
+    }
+
+    masters.insert(masters.end(), removed_masters.begin(), removed_masters.end());
+}
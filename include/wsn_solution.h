@@ -19,14 +19,6 @@ public:
     bool is_valid(std::string filepath);
 };
 
-WSN_solution::WSN_solution(const WSN_data &instance) : instance(instance)
-{
-}
-
-WSN_solution::~WSN_solution()
-{
-}
-
 template <class T>
 bool WSN_solution::is_valid(std::vector<std::vector<int>> &edges, T &masters,
                             T &bridges)
@@ -1,6 +1,6 @@
 #!/bin/bash
 
-FILES_EXT="out sol warn.log lp log"
+FILES_EXT="out sol warn.log lp log trajectory"
 
 dt=$(date '+%d%m%Y%H%M%S');
 FOLDER="results-experiment_$dt"
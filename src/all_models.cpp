@@ -4,6 +4,9 @@
 #include "wsn_data.h"
 
 #include "all_models.h"
+#include "wsn_decomposition.h"
+#include "wsn_batch.h"
+#include "util_model_size.h"
 
 ILOSTLBEGIN
 
@@ -13,39 +16,172 @@ int main(int argc, char *argv[])
     {
         auto params = read_arguments(argc, argv);
 
+        perf::PhaseRecorder phases;
+        phases.start(perf::Phase::Parse);
         WSN_data instance(params.instance_path, params.number_sinks);
+        phases.stop();
 
         std::cout << params.instance_path << " | K: " << params.number_sinks << "   " << std::endl;
         std::cout << "n:" << instance.n << std::endl;
 
-        std::unique_ptr<ModelRunner<WSN>> model_runner;
+        if (!params.batch_path.empty())
+        {
+            if (params.sweep || params.preprocess || params.decompose)
+            {
+                throw std::invalid_argument("--batch can not be used with --sweep, --preprocess or --decompose");
+            }
+
+            WSN_batch batch(instance, (params.upper_bound > 0) ? params.upper_bound : std::numeric_limits<double>::max(),
+                            params.summary_path);
+            batch.use_lower_bounds = params.lower_bounds;
+            batch.solver_params = params.solver;
+            batch.memory_budget = params.memory_budget;
+            batch.fast_relaxed = params.fast_relaxed;
+            batch.reduced_cost_fixing = params.reduced_cost_fixing;
+            batch.symmetry = params.symmetry;
+            batch.symmetry_branching = params.symmetry_branching;
+            auto runs = batch.solve(experiment::read_jobs(params.batch_path), params.workers);
+
+            // a batch with a failed job is a failed run (see run_experiments)
+            bool failed = std::any_of(runs.begin(), runs.end(), [](const RunSummary &run)
+                                      { return run.status == "Error"; });
+
+            return failed ? 1 : 0;
+        }
+
+        if ((int)instance.connected_components().size() > instance.number_trees)
+        {
+            throw std::invalid_argument("Infeasible instance: there are more connected components than trees");
+        }
+
+        if (params.preprocess && params.sweep)
+        {
+            throw std::invalid_argument("The preprocessing changes the number of sinks, it can not be used with --sweep");
+        }
+
+        if (params.reduced_cost_fixing && (params.sweep || params.decompose))
+        {
+            throw std::invalid_argument("--reduced-cost-fixing depends on the number of sinks, it can not be used with --sweep or --decompose");
+        }
+
+        if (params.lower_bounds && (params.sweep || params.decompose))
+        {
+            throw std::invalid_argument("--lower-bounds depends on the number of sinks, it can not be used with --sweep or --decompose");
+        }
+
+        if (params.decompose)
+        {
+            if (params.sweep || params.preprocess)
+            {
+                throw std::invalid_argument("--decompose can not be used with --sweep or --preprocess");
+            }
+
+            WSN_decomposition decomposition(instance, params.model, params.upper_bound, params.summary_path);
+            decomposition.run_id = params.run_id;
+            decomposition.solver_params = params.solver;
+            decomposition.phases = phases;
+            decomposition.solve(params.relaxed);
+
+            return 0;
+        }
 
-        if (params.upper_bound > 0)
+        // the models are built on the reduced instance when the preprocessing is used
+        std::unique_ptr<WSN_reduction> reduction;
+
+        if (params.preprocess)
+        {
+            phases.start(perf::Phase::Preprocess);
+            reduction = std::make_unique<WSN_reduction>(instance);
+            phases.stop();
+
+            std::cout << "reduced n:" << (*reduction).reduced_instance().n
+                      << " | K: " << (*reduction).reduced_instance().number_trees
+                      << " | not bridges: " << (*reduction).not_bridge.size()
+                      << " | fixed arcs: " << (*reduction).fixed_arcs.size() << std::endl;
+        }
+
+        WSN_data &model_instance = params.preprocess ? (*reduction).reduced_instance() : instance;
+
+        // an unknown name is reported with the registered ones, before the size estimate
+        check_model_name(params.model);
+        if (!params.fallback_model.empty())
+        {
+            check_model_name(params.fallback_model);
+        }
+
+        std::cout << params.model << " | " << model_size::estimate(params.model, model_instance) << std::endl;
+
+        auto model_name = model_size::model_within_budget(params.model, params.fallback_model, model_instance,
+                                                          params.memory_budget);
+
+        if (model_name.empty())
         {
-            model_runner = initialize_all_models(instance, params.upper_bound);
+            std::cout << "The model exceeds the memory budget of " << params.memory_budget << " MB" << std::endl;
+
+            auto run = model_size::over_budget_run(params.model, model_instance, params.relaxed);
+            run.time_now = print::time_now();
+            run.run_id = params.run_id;
+            summary::add_resources(run, phases);
+            summary::append(params.summary_path, run);
+
+            return 0;
+        }
+
+        if (model_name != params.model)
+        {
+            std::cout << "The model exceeds the memory budget, solving " << model_name << " | "
+                      << model_size::estimate(model_name, model_instance) << std::endl;
+        }
+
+        // only the chosen model is created, so a run does not build the environments of the others
+        auto model = create_model(model_name, model_instance,
+                                  (params.upper_bound > 0) ? params.upper_bound : std::numeric_limits<double>::max());
+
+        (*model).summary_path = params.summary_path;
+        (*model).run_id = params.run_id;
+        (*model).reduction = reduction.get();
+        (*model).use_lower_bounds = params.lower_bounds;
+        (*model).solver_params = params.solver;
+        (*model).phases = phases;
+        (*model).fast_relaxed = params.fast_relaxed;
+        (*model).export_root_lp = params.export_root_lp;
+        (*model).reduced_cost_fixing = params.reduced_cost_fixing;
+        (*model).symmetry = params.symmetry;
+        (*model).symmetry_branching = params.symmetry_branching;
+        (*model).check_model_options();
+
+        if (params.sweep)
+        {
+            (*model).solve_sweep(params.relaxed);
         }
         else
         {
-            model_runner = initialize_all_models(instance);
+            (*model).solve(params.relaxed);
         }
 
-        (*model_runner).run_model(params.model, params.relaxed);
+        std::cout << (*model).phases;
+
+        (*model).env.end();
     }
     catch (IloException &e)
     {
         cerr << "Concert exception caught: " << e << endl;
+        return 1;
     }
     catch (const string &e)
     {
         cerr << "Exception caught: " << e << endl;
+        return 1;
     }
     catch (exception &e)
     {
         cerr << "Exception caught: " << e.what() << endl;
+        return 1;
     }
     catch (...)
     {
         cerr << "Unknown exception caught." << endl;
+        return 1;
     }
 
     return 0;
@@ -0,0 +1,73 @@
+#include "arguments_parser.h"
+
+#include <iostream>
+#include <memory>
+#include "wsn_data.h"
+
+#include "backend/wsn_backend_model.h"
+
+#ifdef WSN_BACKEND_HIGHS
+#include "backend/highs_backend.h"
+#else
+#include "backend/cplex_backend.h"
+#endif
+
+int main(int argc, char *argv[])
+{
+    try
+    {
+        auto params = read_arguments(argc, argv);
+
+        perf::PhaseRecorder phases;
+        phases.start(perf::Phase::Parse);
+        WSN_data instance(params.instance_path, params.number_sinks);
+        phases.stop();
+
+        std::cout << params.instance_path << " | K: " << params.number_sinks << "   " << std::endl;
+        std::cout << "n:" << instance.n << std::endl;
+
+        if ((int)instance.connected_components().size() > instance.number_trees)
+        {
+            throw std::invalid_argument("Infeasible instance: there are more connected components than trees");
+        }
+
+#ifdef WSN_BACKEND_HIGHS
+        backend::HighsBackend solver;
+#else
+        backend::CplexBackend solver;
+#endif
+
+        std::unique_ptr<WSN_backend_model> model;
+
+        if (params.upper_bound > 0)
+        {
+            model = std::make_unique<WSN_backend_model>(instance, solver, params.upper_bound);
+        }
+        else
+        {
+            model = std::make_unique<WSN_backend_model>(instance, solver);
+        }
+
+        (*model).summary_path = params.summary_path;
+        (*model).run_id = params.run_id;
+        (*model).phases = phases;
+        (*model).solve(params.solver.time_limit, params.solver.threads);
+    }
+    catch (const std::string &e)
+    {
+        std::cerr << "Exception caught: " << e << std::endl;
+        return 1;
+    }
+    catch (std::exception &e)
+    {
+        std::cerr << "Exception caught: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "Unknown exception caught." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
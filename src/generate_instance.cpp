@@ -0,0 +1,99 @@
+#include <iostream>
+#include <string>
+#include <getopt.h>
+
+#include "wsn_generator.h"
+
+/**
+ * @brief Print a help message
+ *
+ */
+void PrintHelp()
+{
+    std::cout << "-n, --nodes <n>:            Number of sensors\n"
+                 "-a, --area <side>:          Side of the square area (default 100)\n"
+                 "-r, --range <range>:        Radio range (default 20)\n"
+                 "-w, --weight <model>:       Weight model: distance | energy (default distance)\n"
+                 "-e, --path-loss <exp>:      Path loss exponent of the energy model (default 2)\n"
+                 "-s, --seed <seed>:          Seed of the generator (default 0)\n"
+                 "-o, --output <path>:        Path of the instance without extension (writes .txt and .wsnb)\n"
+                 "-h, --help:                 Show help\n";
+    exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *const short_opts = "n:a:r:w:e:s:o:h";
+    const option long_opts[] = {
+        {"nodes", required_argument, nullptr, 'n'},
+        {"area", required_argument, nullptr, 'a'},
+        {"range", required_argument, nullptr, 'r'},
+        {"weight", required_argument, nullptr, 'w'},
+        {"path-loss", required_argument, nullptr, 'e'},
+        {"seed", required_argument, nullptr, 's'},
+        {"output", required_argument, nullptr, 'o'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, no_argument, nullptr, 0}};
+
+    try
+    {
+        generator::GeometricParams params;
+        std::string output;
+
+        while (true)
+        {
+            const auto opt = getopt_long(argc, argv, short_opts, long_opts, nullptr);
+
+            if (-1 == opt)
+                break;
+
+            switch (opt)
+            {
+            case 'n':
+                params.n = std::stoi(optarg);
+                break;
+            case 'a':
+                params.area = std::stod(optarg);
+                break;
+            case 'r':
+                params.range = std::stod(optarg);
+                break;
+            case 'w':
+                params.weight = generator::weight_model(optarg);
+                break;
+            case 'e':
+                params.path_loss = std::stod(optarg);
+                break;
+            case 's':
+                params.seed = std::stoull(optarg);
+                break;
+            case 'o':
+                output = std::string(optarg);
+                break;
+            case 'h':
+            case '?':
+            default:
+                PrintHelp();
+                break;
+            }
+        }
+
+        if (output.empty())
+        {
+            output = "rgg_" + std::to_string(params.n) + "_" + std::to_string(params.seed);
+        }
+
+        auto network = generator::random_geometric(params);
+        generator::write_network(network, output);
+
+        std::cout << output << " | n: " << network.n << " | edges: " << network.edges.size()
+                  << " | components: " << generator::number_of_components(network) << std::endl;
+    }
+    catch (std::exception &e)
+    {
+        std::cerr << "Exception caught: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,325 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <getopt.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include <sys/prctl.h>
+
+#include "experiment_runner.h"
+
+// set by SIGINT and SIGTERM, the runner stops launching runs and ends the running ones
+volatile std::sig_atomic_t interrupted = 0;
+
+void interrupt(int)
+{
+    interrupted = 1;
+}
+
+struct Runner_Params
+{
+    std::string manifest;
+    std::string binary = "./build/all_models";
+    std::string summary_path = "results.csv";
+    std::string output_dir = "results";
+    int slots = 1;
+    int threads = 1;
+    long memory_mb = 0; // 0 does not limit the memory of the runs
+    bool dry_run = false;
+};
+
+/**
+ * @brief Print a help message
+ *
+ */
+void PrintHelp()
+{
+    std::cout << "run_experiments [options] <manifest>\n"
+                 "-j, --slots <n>:            Number of runs at the same time (default 1)\n"
+                 "-t, --threads <n>:          Threads of each run, pinned to disjoint cores (default 1)\n"
+                 "-M, --memory <MB>:          Address space limit and memory budget of the model of each run (default no limit)\n"
+                 "-o, --summary <path>:       Results table, runs completed on it (<path>.done) are skipped (default results.csv)\n"
+                 "-d, --output-dir <path>:    Directory with one directory of output files per run (default results)\n"
+                 "-b, --binary <path>:        Program that solves a run (default ./build/all_models)\n"
+                 "-n, --dry-run:              Print the pending runs without solving them\n"
+                 "-h, --help:                 Show help\n";
+    exit(1);
+}
+
+Runner_Params read_runner_arguments(int argc, char **argv)
+{
+    const char *const short_opts = "j:t:M:o:d:b:nh";
+    const option long_opts[] = {
+        {"slots", required_argument, nullptr, 'j'},
+        {"threads", required_argument, nullptr, 't'},
+        {"memory", required_argument, nullptr, 'M'},
+        {"summary", required_argument, nullptr, 'o'},
+        {"output-dir", required_argument, nullptr, 'd'},
+        {"binary", required_argument, nullptr, 'b'},
+        {"dry-run", no_argument, nullptr, 'n'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, no_argument, nullptr, 0}};
+
+    Runner_Params params;
+
+    while (true)
+    {
+        const auto opt = getopt_long(argc, argv, short_opts, long_opts, nullptr);
+
+        if (-1 == opt)
+            break;
+
+        switch (opt)
+        {
+        case 'j':
+            params.slots = std::max(1, std::stoi(optarg));
+            break;
+        case 't':
+            params.threads = std::max(1, std::stoi(optarg));
+            break;
+        case 'M':
+            params.memory_mb = std::stol(optarg);
+            break;
+        case 'o':
+            params.summary_path = std::string(optarg);
+            break;
+        case 'd':
+            params.output_dir = std::string(optarg);
+            break;
+        case 'b':
+            params.binary = std::string(optarg);
+            break;
+        case 'n':
+            params.dry_run = true;
+            break;
+        case 'h':
+        case '?':
+        default:
+            PrintHelp();
+            break;
+        }
+    }
+
+    if (optind != argc - 1)
+    {
+        PrintHelp();
+    }
+
+    params.manifest = argv[optind];
+
+    return params;
+}
+
+/**
+ * @brief Start a run on a child process. The child is pinned to the cores of its slot, has
+ * its address space limited, writes its files and its log on the directory of the run and
+ * is killed if the runner dies (so a killed sweep leaves no run writing on the table).
+ *
+ * @return pid_t is the pid of the child
+ */
+pid_t start_run(const experiment::Run &run, const Runner_Params &params, const std::vector<int> &cores)
+{
+    auto directory = std::filesystem::absolute(params.output_dir) / experiment::directory_name(run.id);
+    std::filesystem::create_directories(directory);
+
+    auto arguments = experiment::run_arguments(run, std::filesystem::absolute(params.summary_path).string(),
+                                               params.threads, params.memory_mb);
+    arguments.insert(arguments.begin(), std::filesystem::absolute(params.binary).string());
+
+    pid_t parent = getpid();
+    pid_t pid = fork();
+
+    if (pid != 0)
+    {
+        return pid;
+    }
+
+    prctl(PR_SET_PDEATHSIG, SIGTERM);
+
+    if (getppid() != parent)
+    {
+        _exit(1);
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int core : cores)
+    {
+        CPU_SET(core, &set);
+    }
+    sched_setaffinity(0, sizeof(set), &set);
+
+    if (params.memory_mb > 0)
+    {
+        rlimit limit;
+        limit.rlim_cur = limit.rlim_max = (rlim_t)params.memory_mb * 1024 * 1024;
+        setrlimit(RLIMIT_AS, &limit);
+    }
+
+    int log = open((directory / "run.log").c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+
+    if (chdir(directory.c_str()) != 0 || log < 0)
+    {
+        _exit(1);
+    }
+
+    dup2(log, STDOUT_FILENO);
+    dup2(log, STDERR_FILENO);
+    close(log);
+
+    std::vector<char *> argv;
+    for (auto &argument : arguments)
+    {
+        argv.push_back(const_cast<char *>(argument.c_str()));
+    }
+    argv.push_back(nullptr);
+
+    execv(argv[0], argv.data());
+    _exit(127);
+}
+
+int main(int argc, char *argv[])
+{
+    try
+    {
+        auto params = read_runner_arguments(argc, argv);
+
+        auto runs = experiment::read_manifest(params.manifest);
+        auto completed = experiment::completed_table(params.summary_path);
+        auto pending = experiment::pending_runs(runs, experiment::read_completed(completed));
+
+        for (auto &run : pending)
+        {
+            run.instance_path = std::filesystem::absolute(run.instance_path).string();
+        }
+
+        std::cout << params.manifest << " | runs: " << runs.size() << " | pending: " << pending.size()
+                  << " | slots: " << params.slots << " | threads: " << params.threads << std::endl;
+
+        if (params.dry_run)
+        {
+            for (auto &run : pending)
+            {
+                std::cout << run.id << std::endl;
+            }
+
+            return 0;
+        }
+
+        // without SA_RESTART, so a signal interrupts waitpid
+        struct sigaction action;
+        std::memset(&action, 0, sizeof(action));
+        action.sa_handler = interrupt;
+        sigaction(SIGINT, &action, nullptr);
+        sigaction(SIGTERM, &action, nullptr);
+
+        int cores = std::max(1u, std::thread::hardware_concurrency());
+
+        // run of each slot, -1 if the slot is free
+        std::vector<pid_t> slot_pid(params.slots, -1);
+        std::vector<int> slot_run(params.slots, -1);
+        std::vector<std::chrono::steady_clock::time_point> slot_start(params.slots);
+
+        int next = 0;
+        int running = 0;
+        int failed = 0;
+
+        while (next < (int)pending.size() || running > 0)
+        {
+            for (int slot = 0; slot < params.slots && next < (int)pending.size() && !interrupted; slot++)
+            {
+                if (slot_pid[slot] == -1)
+                {
+                    slot_run[slot] = next++;
+                    slot_start[slot] = std::chrono::steady_clock::now();
+                    slot_pid[slot] = start_run(pending[slot_run[slot]], params,
+                                               experiment::slot_cores(slot, params.threads, cores));
+                    running++;
+
+                    std::cout << "[" << next << "/" << pending.size() << "] start " << pending[slot_run[slot]].id << std::endl;
+                }
+            }
+
+            if (interrupted && next <= (int)pending.size())
+            {
+                // end the running runs, they are solved again on the next call
+                for (auto child : slot_pid)
+                {
+                    if (child != -1)
+                    {
+                        kill(child, SIGTERM);
+                    }
+                }
+                next = pending.size() + 1;
+            }
+
+            if (running == 0)
+            {
+                break;
+            }
+
+            int status;
+            pid_t pid = waitpid(-1, &status, 0);
+
+            if (pid < 0)
+            {
+                continue;
+            }
+
+            for (int slot = 0; slot < params.slots; slot++)
+            {
+                if (slot_pid[slot] == pid)
+                {
+                    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - slot_start[slot];
+                    bool success = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+
+                    failed += success ? 0 : 1;
+
+                    if (success)
+                    {
+                        experiment::mark_completed(completed, pending[slot_run[slot]].id);
+                    }
+
+                    std::cout << (success ? "done " : "failed ") << pending[slot_run[slot]].id << " ("
+                              << elapsed.count() << " s";
+                    if (WIFSIGNALED(status))
+                    {
+                        std::cout << ", " << strsignal(WTERMSIG(status));
+                    }
+                    std::cout << ")" << std::endl;
+
+                    slot_pid[slot] = -1;
+                    running--;
+                }
+            }
+        }
+
+        if (interrupted)
+        {
+            std::cerr << "Interrupted, the runs that are not on " << completed << " run on the next call" << std::endl;
+            return 130;
+        }
+
+        std::cout << "finished | failed: " << failed << std::endl;
+
+        if (failed > 0)
+        {
+            return 1;
+        }
+    }
+    catch (std::exception &e)
+    {
+        std::cerr << "Exception caught: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
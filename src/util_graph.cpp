@@ -0,0 +1,98 @@
+#include "util_graph.h"
+
+std::vector<std::array<int, 3>> list_triangles(const std::vector<std::set<int>> &adj_list)
+{
+    int n = adj_list.size();
+
+    // undirected neighbors, from the arcs of both directions
+    std::vector<std::vector<int>> neighbors(n);
+
+    for (int i = 0; i < n; i++)
+    {
+        for (auto &j : adj_list[i])
+        {
+            if (i != j)
+            {
+                neighbors[i].push_back(j);
+                neighbors[j].push_back(i);
+            }
+        }
+    }
+
+    for (auto &list : neighbors)
+    {
+        std::sort(list.begin(), list.end());
+        list.erase(std::unique(list.begin(), list.end()), list.end());
+    }
+
+    auto lower_rank = [&](int a, int b)
+    {
+        return (neighbors[a].size() < neighbors[b].size()) || (neighbors[a].size() == neighbors[b].size() && a < b);
+    };
+
+    // out-neighbors on the degree orientation, sorted by node
+    std::vector<std::vector<int>> out(n);
+
+    for (int i = 0; i < n; i++)
+    {
+        for (auto &j : neighbors[i])
+        {
+            if (lower_rank(i, j))
+            {
+                out[i].push_back(j);
+            }
+        }
+    }
+
+    std::vector<std::array<int, 3>> triangles;
+    std::vector<int> common;
+
+    for (int u = 0; u < n; u++)
+    {
+        for (auto &v : out[u])
+        {
+            common.clear();
+            std::set_intersection(out[u].begin(), out[u].end(), out[v].begin(), out[v].end(), std::back_inserter(common));
+
+            for (auto &w : common)
+            {
+                std::array<int, 3> triangle({u, v, w});
+                std::sort(triangle.begin(), triangle.end());
+
+                triangles.push_back(triangle);
+            }
+        }
+    }
+
+    std::sort(triangles.begin(), triangles.end());
+
+    return triangles;
+}
+
+std::vector<std::array<int, 3>> list_ordered_triangles(const std::vector<std::set<int>> &adj_list)
+{
+    std::vector<std::array<int, 3>> ordered;
+
+    auto has_arc = [&](int from, int to)
+    {
+        return adj_list[from].find(to) != adj_list[from].end();
+    };
+
+    for (auto &triangle : list_triangles(adj_list))
+    {
+        // triangle is sorted, so the permutations are generated in lexicographic order
+        do
+        {
+            auto [i, j, k] = triangle;
+
+            if (has_arc(i, j) && has_arc(j, k) && has_arc(i, k))
+            {
+                ordered.push_back(triangle);
+            }
+        } while (std::next_permutation(triangle.begin(), triangle.end()));
+    }
+
+    std::sort(ordered.begin(), ordered.end());
+
+    return ordered;
+}
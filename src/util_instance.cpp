@@ -0,0 +1,215 @@
+#include "util_instance.h"
+#include <iomanip>
+#include <cstdint>
+#include <algorithm>
+
+int numero(std::string num)
+{
+    std::stringstream ss(num);
+    int retorno = 0;
+    ss >> retorno;
+    return retorno;
+}
+
+double numerodouble(std::string num)
+{
+    std::stringstream ss(num);
+    double retorno = 0;
+    ss >> retorno;
+    return retorno;
+}
+
+std::vector<std::set<int>> to_adj_list_out(std::vector<std::vector<int>> &adj_matrix)
+{
+    int n = adj_matrix.size();
+
+    std::vector<std::set<int>> adj_list(n, std::set<int>());
+
+    for (int from = 0; from < n; from++)
+    {
+        for (int to = 0; to < n; to++)
+        {
+            if (adj_matrix[from][to] == 1)
+            {
+                adj_list[from].insert(to);
+            }
+        }
+    }
+
+    return adj_list;
+}
+
+std::vector<std::set<int>> to_adj_list_in(std::vector<std::vector<int>> &adj_matrix)
+{
+    int n = adj_matrix.size();
+
+    std::vector<std::set<int>> adj_list(n, std::set<int>());
+
+    for (int from = 0; from < n; from++)
+    {
+        for (int to = 0; to < n; to++)
+        {
+            if (adj_matrix[from][to] == 1)
+            {
+                adj_list[to].insert(from);
+            }
+        }
+    }
+
+    return adj_list;
+}
+
+int read_instance_wsn(std::string instance_path,
+                  std::vector<std::vector<double>> &weight_matrix,
+                  std::vector<std::vector<int>> &adjacency_matrix)
+{
+    int number_nodes;
+    int number_edges;
+    int entrada;
+    int saida;
+    std::string auxiliar;
+    std::ifstream arquivo(instance_path);
+
+    if (arquivo.is_open())
+    {
+        arquivo >> auxiliar;
+        number_nodes = numero(auxiliar);
+
+        arquivo >> auxiliar;
+        number_edges = numero(auxiliar);
+        
+        weight_matrix = std::vector<std::vector<double>>(number_nodes, std::vector<double>(number_nodes, 1000));
+        adjacency_matrix = std::vector<std::vector<int>>(number_nodes, std::vector<int>(number_nodes, 0));
+
+        for (int i = 0; i < number_edges; i++)
+        {
+            arquivo >> auxiliar;
+            entrada = numero(auxiliar) - 1;
+
+            arquivo >> auxiliar;
+            saida = numero(auxiliar) - 1;
+
+            arquivo >> auxiliar;
+            weight_matrix[entrada][saida] = numerodouble(auxiliar);
+            weight_matrix[saida][entrada] = numerodouble(auxiliar);
+            
+            adjacency_matrix[entrada][saida] = 1;
+            adjacency_matrix[saida][entrada] = 1;
+        }
+
+        arquivo.close();
+    }
+
+    return number_nodes;
+}
+
+void write_instance_wsn(std::string instance_path, int number_nodes, const std::vector<WeightedEdge> &edges)
+{
+    std::ofstream arquivo(instance_path);
+
+    if (!arquivo.is_open())
+    {
+        throw std::runtime_error("Could not write the instance " + instance_path);
+    }
+
+    arquivo << std::setw(4) << number_nodes << " " << std::setw(6) << edges.size() << std::endl;
+    arquivo << std::fixed << std::setprecision(2);
+
+    for (auto &edge : edges)
+    {
+        arquivo << std::setw(4) << edge.from + 1 << " " << std::setw(6) << edge.to + 1
+                << " " << std::setw(7) << edge.weight << std::endl;
+    }
+}
+
+const char binary_magic[4] = {'W', 'S', 'N', 'B'};
+const uint32_t binary_version = 1;
+
+void write_instance_binary(std::string instance_path, int number_nodes, const std::vector<WeightedEdge> &edges)
+{
+    std::ofstream arquivo(instance_path, std::ios::binary);
+
+    if (!arquivo.is_open())
+    {
+        throw std::runtime_error("Could not write the instance " + instance_path);
+    }
+
+    int32_t header[2] = {number_nodes, (int32_t)edges.size()};
+
+    arquivo.write(binary_magic, sizeof(binary_magic));
+    arquivo.write(reinterpret_cast<const char *>(&binary_version), sizeof(binary_version));
+    arquivo.write(reinterpret_cast<const char *>(header), sizeof(header));
+
+    for (auto &edge : edges)
+    {
+        int32_t nodes[2] = {edge.from, edge.to};
+
+        arquivo.write(reinterpret_cast<const char *>(nodes), sizeof(nodes));
+        arquivo.write(reinterpret_cast<const char *>(&edge.weight), sizeof(edge.weight));
+    }
+}
+
+int read_instance_binary(std::string instance_path,
+                         std::vector<std::vector<double>> &weight_matrix,
+                         std::vector<std::vector<int>> &adjacency_matrix)
+{
+    std::ifstream arquivo(instance_path, std::ios::binary);
+
+    char magic[4];
+    uint32_t version = 0;
+    int32_t header[2] = {0, 0};
+
+    arquivo.read(magic, sizeof(magic));
+    arquivo.read(reinterpret_cast<char *>(&version), sizeof(version));
+    arquivo.read(reinterpret_cast<char *>(header), sizeof(header));
+
+    if (!arquivo || !std::equal(magic, magic + 4, binary_magic) || version != binary_version)
+    {
+        throw std::runtime_error("Invalid binary instance " + instance_path);
+    }
+
+    int number_nodes = header[0];
+    int number_edges = header[1];
+
+    // same default weight of the text format for the pairs that are not edges
+    weight_matrix = std::vector<std::vector<double>>(number_nodes, std::vector<double>(number_nodes, 1000));
+    adjacency_matrix = std::vector<std::vector<int>>(number_nodes, std::vector<int>(number_nodes, 0));
+
+    for (int i = 0; i < number_edges; i++)
+    {
+        int32_t nodes[2];
+        double weight;
+
+        arquivo.read(reinterpret_cast<char *>(nodes), sizeof(nodes));
+        arquivo.read(reinterpret_cast<char *>(&weight), sizeof(weight));
+
+        if (!arquivo || nodes[0] < 0 || nodes[0] >= number_nodes || nodes[1] < 0 || nodes[1] >= number_nodes)
+        {
+            throw std::runtime_error("Invalid binary instance " + instance_path);
+        }
+
+        weight_matrix[nodes[0]][nodes[1]] = weight;
+        weight_matrix[nodes[1]][nodes[0]] = weight;
+
+        adjacency_matrix[nodes[0]][nodes[1]] = 1;
+        adjacency_matrix[nodes[1]][nodes[0]] = 1;
+    }
+
+    return number_nodes;
+}
+
+int read_instance(std::string instance_path,
+                  std::vector<std::vector<double>> &weight_matrix,
+                  std::vector<std::vector<int>> &adjacency_matrix)
+{
+    std::string extension = ".wsnb";
+    bool is_binary = instance_path.size() >= extension.size() &&
+                     instance_path.compare(instance_path.size() - extension.size(), extension.size(), extension) == 0;
+
+    if (is_binary)
+    {
+        return read_instance_binary(instance_path, weight_matrix, adjacency_matrix);
+    }
+
+    return read_instance_wsn(instance_path, weight_matrix, adjacency_matrix);
+}
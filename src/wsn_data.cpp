@@ -0,0 +1,117 @@
+#include "wsn_data.h"
+
+// WSN_data::WSN_data(/* args */)
+// {
+// }
+
+WSN_data::WSN_data(std::vector<std::vector<double>> &weight, std::vector<std::vector<int>> &is_connected,
+                   int n, int number_of_trees) : weight(weight), is_connected(is_connected),
+                                                 n(n), number_trees(number_of_trees),
+                                                 is_file_instance(false)
+{
+    initialize_calculated_data();
+}
+
+WSN_data::WSN_data(std::vector<std::vector<double>> &weight, std::vector<std::vector<int>> &is_connected,
+                   int n) : weight(weight), is_connected(is_connected),
+                            n(n), number_trees(1), is_file_instance(false)
+{
+    initialize_calculated_data();
+}
+
+WSN_data::WSN_data(std::string path, int number_trees) : instance_path(path),
+                                                         number_trees(number_trees),
+                                                         is_file_instance(true)
+{
+    WSN_data::n = read_instance(instance_path, WSN_data::weight, WSN_data::is_connected);
+
+    initialize_calculated_data();
+}
+
+WSN_data::WSN_data(std::string path) : instance_path(path),
+                                       number_trees(1),
+                                       is_file_instance(true)
+{
+    WSN_data::n = read_instance(instance_path, WSN_data::weight, WSN_data::is_connected);
+
+    initialize_calculated_data();
+}
+
+WSN_data::~WSN_data()
+{
+}
+
+void WSN_data::initialize_calculated_data()
+{
+    WSN_data::adj_list_from_v = to_adj_list_out(WSN_data::is_connected);
+    WSN_data::adj_list_to_v = to_adj_list_in(WSN_data::is_connected);
+}
+
+void WSN_data::set_number_trees(int number_of_trees)
+{
+    WSN_data::number_trees = number_of_trees;
+}
+
+std::vector<std::vector<int>> WSN_data::connected_components()
+{
+    std::vector<std::vector<int>> components;
+    std::vector<bool> is_visited(n, false);
+
+    for (int start = 0; start < n; start++)
+    {
+        if (is_visited[start])
+        {
+            continue;
+        }
+
+        std::vector<int> component;
+        std::vector<int> stack({start});
+        is_visited[start] = true;
+
+        while (!stack.empty())
+        {
+            int current = stack.back();
+            stack.pop_back();
+            component.push_back(current);
+
+            for (auto *neighbors : {&adj_list_from_v[current], &adj_list_to_v[current]})
+            {
+                for (auto &next : *neighbors)
+                {
+                    if (!is_visited[next])
+                    {
+                        is_visited[next] = true;
+                        stack.push_back(next);
+                    }
+                }
+            }
+        }
+
+        std::sort(component.begin(), component.end());
+        components.push_back(component);
+    }
+
+    return components;
+}
+
+void WSN_data::set_instance_path(std::string path)
+{
+    WSN_data::instance_path = path;
+}
+
+std::string WSN_data::name()
+{
+    auto instance_name = std::filesystem::path(instance_path).filename().stem().string();
+    std::replace(instance_name.begin(), instance_name.end(), '_', '-');
+
+    return instance_name;
+}
+
+std::ostream &operator<<(std::ostream &os, const WSN_data &l)
+{
+    os << "instance_path:\t" << (l.is_file_instance ? l.instance_path : "None") << std::endl;
+    os << "number_nodes:\t" << l.n << std::endl;
+    os << "number_trees:\t" << l.number_trees << std::endl;
+
+    return os;
+}
@@ -0,0 +1,124 @@
+#include "wsn_generator.h"
+
+#include <cmath>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+
+namespace generator
+{
+    double uniform(std::mt19937_64 &rng)
+    {
+        return (rng() >> 11) * 0x1.0p-53;
+    }
+
+    WeightModel weight_model(const std::string &name)
+    {
+        if (name == "distance")
+        {
+            return WeightModel::Distance;
+        }
+
+        if (name == "energy")
+        {
+            return WeightModel::Energy;
+        }
+
+        throw std::invalid_argument("Unknown weight model " + name + " (use distance or energy)");
+    }
+
+    SensorNetwork random_geometric(const GeometricParams &params)
+    {
+        if (params.n <= 0 || params.area <= 0 || params.range <= 0)
+        {
+            throw std::invalid_argument("The number of sensors, the area and the range should be positive");
+        }
+
+        std::mt19937_64 rng(params.seed);
+
+        SensorNetwork network;
+        network.n = params.n;
+
+        for (int i = 0; i < params.n; i++)
+        {
+            double x = uniform(rng) * params.area;
+            double y = uniform(rng) * params.area;
+
+            network.position.push_back({x, y});
+        }
+
+        double range_squared = params.range * params.range;
+
+        for (int i = 0; i < params.n; i++)
+        {
+            for (int j = i + 1; j < params.n; j++)
+            {
+                double dx = network.position[i].first - network.position[j].first;
+                double dy = network.position[i].second - network.position[j].second;
+                double squared = dx * dx + dy * dy;
+
+                if (squared > range_squared)
+                {
+                    continue;
+                }
+
+                double weight;
+
+                if (params.weight == WeightModel::Distance)
+                {
+                    weight = std::sqrt(squared);
+                }
+                else
+                {
+                    weight = (params.path_loss == 2) ? squared : std::pow(squared, params.path_loss / 2);
+                }
+
+                // two decimals, so the text format and the binary cache are read as the same instance
+                weight = std::round(weight * 100) / 100;
+
+                network.edges.push_back({i, j, weight});
+            }
+        }
+
+        return network;
+    }
+
+    int number_of_components(const SensorNetwork &network)
+    {
+        std::vector<int> parent(network.n);
+        std::iota(parent.begin(), parent.end(), 0);
+
+        auto find = [&](int node)
+        {
+            while (parent[node] != node)
+            {
+                parent[node] = parent[parent[node]];
+                node = parent[node];
+            }
+
+            return node;
+        };
+
+        int components = network.n;
+
+        for (auto &edge : network.edges)
+        {
+            int a = find(edge.from);
+            int b = find(edge.to);
+
+            if (a != b)
+            {
+                parent[a] = b;
+                components--;
+            }
+        }
+
+        return components;
+    }
+
+    void write_network(const SensorNetwork &network, const std::string &path)
+    {
+        write_instance_wsn(path + ".txt", network.n, network.edges);
+        write_instance_binary(path + ".wsnb", network.n, network.edges);
+    }
+} // namespace generator
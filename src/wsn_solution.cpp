@@ -0,0 +1,9 @@
+#include "wsn_solution.h"
+
+WSN_solution::WSN_solution(const WSN_data &instance) : instance(instance)
+{
+}
+
+WSN_solution::~WSN_solution()
+{
+}
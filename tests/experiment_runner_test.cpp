@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
+#include "experiment_runner.h"
+
+TEST(ExperimentRunner, TestParseTrees)
+{
+    EXPECT_EQ(std::vector<int>({3}), experiment::parse_trees("3"));
+    EXPECT_EQ(std::vector<int>({1, 2, 3, 4}), experiment::parse_trees("1-4"));
+    EXPECT_EQ(std::vector<int>({1, 2, 4, 6, 7}), experiment::parse_trees("1,2,4,6-7"));
+
+    EXPECT_THROW(experiment::parse_trees("0"), std::invalid_argument);
+    EXPECT_THROW(experiment::parse_trees("4-2"), std::invalid_argument);
+}
+
+TEST(ExperimentRunner, TestRunId)
+{
+    EXPECT_EQ("MCFModel|den20mtsNodes-20|3|-r --sweep",
+              experiment::run_id("MCFModel", "instances/den20mtsNodes_20.txt", 3, {"-r", "--sweep"}));
+    EXPECT_EQ("MTZ|a|1|", experiment::run_id("MTZ", "a.txt", 1, {}));
+
+    EXPECT_EQ("MCFModel_den20mtsNodes-20_3_-r_--sweep",
+              experiment::directory_name("MCFModel|den20mtsNodes-20|3|-r --sweep"));
+}
+
+TEST(ExperimentRunner, TestReadManifest)
+{
+    auto directory = std::filesystem::temp_directory_path() / "experiment_runner_test";
+    std::filesystem::create_directories(directory);
+
+    std::ofstream((directory / "b_2.txt").c_str()) << "";
+    std::ofstream((directory / "a_1.txt").c_str()) << "";
+
+    std::stringstream manifest;
+    manifest << "# model instances K options\n"
+             << "\n"
+             << "MCFModel " << directory.string() << " 1-2 -r   # relaxed\n"
+             << "MTZ " << (directory / "a_1.txt").string() << " 3\n";
+
+    auto runs = experiment::read_manifest(manifest);
+
+    ASSERT_EQ(5, (int)runs.size());
+
+    EXPECT_EQ("MCFModel|a-1|1|-r", runs[0].id);
+    EXPECT_EQ("MCFModel|a-1|2|-r", runs[1].id);
+    EXPECT_EQ("MCFModel|b-2|1|-r", runs[2].id);
+    EXPECT_EQ("MCFModel|b-2|2|-r", runs[3].id);
+    EXPECT_EQ("MTZ|a-1|3|", runs[4].id);
+
+    EXPECT_EQ(std::vector<std::string>({"-r"}), runs[0].options);
+    EXPECT_EQ(2, runs[3].number_trees);
+    EXPECT_TRUE(runs[4].options.empty());
+
+    std::stringstream invalid("MCFModel instances\n");
+    EXPECT_THROW(experiment::read_manifest(invalid), std::invalid_argument);
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST(ExperimentRunner, TestPendingRuns)
+{
+    std::vector<experiment::Run> runs = {{"A", "i.txt", 1, {}, "A|i|1|"},
+                                         {"A", "i.txt", 2, {}, "A|i|2|"},
+                                         {"A", "i.txt", 1, {}, "A|i|1|"},
+                                         {"B", "i.txt", 1, {}, "B|i|1|"}};
+
+    auto pending = experiment::pending_runs(runs, {"A|i|2|"});
+
+    ASSERT_EQ(2, (int)pending.size());
+    EXPECT_EQ("A|i|1|", pending[0].id);
+    EXPECT_EQ("B|i|1|", pending[1].id);
+}
+
+TEST(ExperimentRunner, TestCompletedRuns)
+{
+    std::string path = experiment::completed_table(testing::TempDir() + "experiment_runner_results.csv");
+    std::remove(path.c_str());
+
+    EXPECT_TRUE(experiment::read_completed(path).empty());
+
+    experiment::mark_completed(path, "A|i|1|-r --sweep");
+    experiment::mark_completed(path, "B|i|2|");
+
+    auto done = experiment::read_completed(path);
+    std::remove(path.c_str());
+
+    EXPECT_EQ(std::set<std::string>({"A|i|1|-r --sweep", "B|i|2|"}), done);
+}
+
+TEST(ExperimentRunner, TestSlotCores)
+{
+    EXPECT_EQ(std::vector<int>({0, 1}), experiment::slot_cores(0, 2, 8));
+    EXPECT_EQ(std::vector<int>({6, 7}), experiment::slot_cores(3, 2, 8));
+    EXPECT_EQ(std::vector<int>({0, 1}), experiment::slot_cores(4, 2, 8));
+    EXPECT_EQ(std::vector<int>({0, 1}), experiment::slot_cores(0, 4, 2));
+}
+
+TEST(ExperimentRunner, TestRunArguments)
+{
+    experiment::Run run{"MTZ", "/tmp/a.txt", 2, {"-r"}, "MTZ|a|2|-r"};
+
+    std::vector<std::string> expected = {"-i", "/tmp/a.txt", "-m", "MTZ", "-K", "2",
+                                         "-o", "/tmp/results.csv", "-R", "MTZ|a|2|-r", "-r"};
+
+    EXPECT_EQ(expected, experiment::run_arguments(run, "/tmp/results.csv"));
+
+    expected.insert(expected.end() - 1, {"-t", "4"});
+
+    EXPECT_EQ(expected, experiment::run_arguments(run, "/tmp/results.csv", 4));
+
+    expected.insert(expected.end() - 1, {"-G", "2000"});
+
+    EXPECT_EQ(expected, experiment::run_arguments(run, "/tmp/results.csv", 4, 2000));
+}
+
+TEST(ExperimentRunner, TestReadJobs)
+{
+    std::stringstream jobs("# model K\nMCFModel 1-2 -r\n\nMTZ-sbpo 3 # mip\n");
+
+    auto list = experiment::read_jobs(jobs);
+
+    ASSERT_EQ(3, (int)list.size());
+    EXPECT_EQ("MCFModel", list[0].model);
+    EXPECT_EQ(1, list[0].number_trees);
+    EXPECT_TRUE(list[0].relaxed);
+    EXPECT_EQ(2, list[1].number_trees);
+    EXPECT_EQ("MTZ-sbpo", list[2].model);
+    EXPECT_EQ(3, list[2].number_trees);
+    EXPECT_FALSE(list[2].relaxed);
+
+    std::stringstream without_trees("MCFModel\n");
+    EXPECT_THROW(experiment::read_jobs(without_trees), std::invalid_argument);
+
+    std::stringstream unknown_option("MCFModel 1 --sweep\n");
+    EXPECT_THROW(experiment::read_jobs(unknown_option), std::invalid_argument);
+}
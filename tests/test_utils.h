@@ -2,6 +2,8 @@
 
 #include <vector>
 
+#include "wsn_data.h"
+
 // create an adjacency matrix given a list of edges (pair of nodes)
 std::vector<std::vector<int>> adj_matrix_from_edges(std::vector<std::vector<int>> edges, int number_nodes)
 {
@@ -26,4 +28,28 @@ std::vector<std::vector<T>> square_matrix(int size, T value)
     std::vector<std::vector<T>> matrix(size, std::vector<T>(size, value));
 
     return matrix;
-}
\ No newline at end of file
+}
+
+// path 0-1-...-(number_nodes - 1) where the arc (i, j) has weight i + j
+WSN_data weighted_path(int number_nodes, int number_trees)
+{
+    std::vector<std::vector<int>> edges;
+
+    for (int i = 0; i + 1 < number_nodes; i++)
+    {
+        edges.push_back({i, i + 1});
+    }
+
+    auto adj_matrix = adj_matrix_from_edges(edges, number_nodes);
+    auto weight = square_matrix(number_nodes, 0.0);
+
+    for (int i = 0; i < number_nodes; i++)
+    {
+        for (int j = 0; j < number_nodes; j++)
+        {
+            weight[i][j] = i + j;
+        }
+    }
+
+    return WSN_data(weight, adj_matrix, number_nodes, number_trees);
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include "util_benders.h"
+#include "test_utils.h"
+
+TEST(BendersSubproblem, TestTreeWeightAndCoefficients)
+{
+    auto instance = weighted_path(6, 2);
+
+    ArcValues arc_value(instance);
+    std::vector<double> sink_value(instance.n, 0.0);
+
+    // tree 1 -> 0, 1 -> 2 -> 3 and the subtour 4 <-> 5
+    sink_value[1] = 1;
+    arc_value.set(1, 0, 1);
+    arc_value.set(1, 2, 1);
+    arc_value.set(2, 3, 1);
+    arc_value.set(4, 5, 1);
+    arc_value.set(5, 4, 1);
+
+    auto subproblem = benders::solve_subproblem(instance, arc_value, sink_value);
+
+    ASSERT_EQ(1, (int)subproblem.trees.size());
+
+    auto &tree = subproblem.trees.front();
+
+    EXPECT_EQ(1, tree.root);
+    EXPECT_DOUBLE_EQ(1 + 3 + 5, tree.weight);
+
+    for (size_t a = 0; a < tree.arcs.size(); a++)
+    {
+        auto [i, j] = tree.arcs[a];
+        double expected = (i == 1 && j == 2) ? 3 + 5 : instance.weight[i][j];
+
+        EXPECT_DOUBLE_EQ(expected, tree.coefficient[a]);
+    }
+
+    EXPECT_EQ(std::vector<std::vector<int>>({{4, 5}}), subproblem.subtours);
+}
+
+TEST(BendersSubproblem, TestOptimalityCutKeepsRootComponent)
+{
+    auto instance = weighted_path(6, 2);
+
+    ArcValues arc_value(instance);
+    std::vector<double> sink_value(instance.n, 0.0);
+
+    sink_value[1] = 1;
+    arc_value.set(1, 0, 1);
+    arc_value.set(1, 2, 1);
+    arc_value.set(2, 3, 1);
+
+    auto tree = benders::solve_subproblem(instance, arc_value, sink_value).trees.front();
+
+    EXPECT_DOUBLE_EQ(tree.weight, benders::optimality_cut_value(tree, arc_value));
+
+    // without 1 -> 2 only the arc 1 -> 0 is certainly in the same tree
+    arc_value.set(1, 2, 0);
+
+    EXPECT_DOUBLE_EQ(1, benders::optimality_cut_value(tree, arc_value));
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include "util_column_generation.h"
+#include "test_utils.h"
+
+// path 0-1-2-3-4 with unit weights
+WSN_data column_path()
+{
+    int number_nodes = 5;
+    auto adj_matrix = adj_matrix_from_edges({{0, 1}, {1, 2}, {2, 3}, {3, 4}}, number_nodes);
+    auto weight = square_matrix(number_nodes, 1.0);
+
+    return WSN_data(weight, adj_matrix, number_nodes, 1);
+}
+
+// every node must be dominated (dual 1) and a column costs 2
+column_generation::Duals domination_duals(int number_nodes)
+{
+    column_generation::Duals duals;
+
+    duals.dominated = std::vector<double>(number_nodes, 1.0);
+    duals.dominating = std::vector<double>(number_nodes, 0.0);
+    duals.edge = square_matrix(number_nodes, 0.0);
+    duals.trees = -2;
+
+    return duals;
+}
+
+TEST(ColumnGeneration, TestColumnsOfSolution)
+{
+    auto instance = column_path();
+
+    std::vector<std::vector<int>> edges({{1, 2}, {2, 3}});
+    std::vector<int> masters({1, 3});
+    std::vector<int> bridges({2});
+
+    auto columns = column_generation::columns_of_solution(instance, edges, masters, bridges);
+
+    ASSERT_EQ(1, (int)columns.size());
+    EXPECT_EQ(std::vector<int>({1, 3}), columns[0].masters);
+    EXPECT_EQ(std::vector<int>({2}), columns[0].bridges);
+    EXPECT_DOUBLE_EQ(2, columns[0].weight);
+}
+
+TEST(ColumnGeneration, TestSingleBridgeColumnHasBestScore)
+{
+    auto instance = column_path();
+    auto duals = domination_duals(instance.n);
+
+    auto columns = column_generation::heuristic_pricing(instance, duals, 10);
+
+    ASSERT_FALSE(columns.empty());
+
+    auto &best = columns.front();
+
+    EXPECT_EQ(std::vector<int>({1, 3}), best.masters);
+    EXPECT_EQ(std::vector<int>({2}), best.bridges);
+    EXPECT_EQ((std::vector<std::pair<int, int>>({{1, 2}, {2, 3}})), best.arcs);
+    EXPECT_DOUBLE_EQ(3, column_generation::score(instance, duals, best));
+
+    for (auto &column : columns)
+    {
+        EXPECT_GT(column_generation::score(instance, duals, column), 0);
+    }
+}
+
+TEST(ColumnGeneration, TestCapLimitsColumns)
+{
+    auto instance = column_path();
+    auto duals = domination_duals(instance.n);
+
+    // only the trees with a single master (weight zero) fit
+    for (auto &column : column_generation::heuristic_pricing(instance, duals, 1.5))
+    {
+        EXPECT_TRUE(column.bridges.empty());
+        EXPECT_DOUBLE_EQ(0, column.weight);
+    }
+}
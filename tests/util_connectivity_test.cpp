@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include "util_connectivity.h"
+#include "test_utils.h"
+
+// path 0-1-2-3-4 and triangle 4-5-6
+WSN_data connectivity_instance()
+{
+    int number_nodes = 7;
+    auto adj_matrix = adj_matrix_from_edges({
+        {0, 1},
+        {1, 2},
+        {2, 3},
+        {3, 4},
+        {4, 5},
+        {5, 6},
+        {4, 6}}, number_nodes);
+    auto weight = square_matrix(number_nodes, 1.0);
+
+    return WSN_data(weight, adj_matrix, number_nodes, 1);
+}
+
+TEST(UnionFind, TestUnite)
+{
+    connectivity::UnionFind sets(4);
+
+    ASSERT_TRUE(sets.unite(0, 1));
+    ASSERT_TRUE(sets.unite(2, 3));
+    ASSERT_FALSE(sets.unite(1, 0));
+    ASSERT_NE(sets.find(0), sets.find(2));
+
+    ASSERT_TRUE(sets.unite(1, 3));
+    ASSERT_EQ(sets.find(0), sets.find(2));
+}
+
+TEST(ArcValues, TestArcsByPosition)
+{
+    auto instance = connectivity_instance();
+    ArcValues arc_value(instance);
+
+    // neighbors of 4 are 3, 5 and 6
+    ASSERT_EQ(3, arc_value.degree(4));
+    ASSERT_EQ(5, arc_value.head(4, 1));
+    ASSERT_EQ(-1, arc_value.position(4, 0));
+
+    arc_value.set(4, 5, 0.5);
+
+    EXPECT_DOUBLE_EQ(0.5, arc_value.at(4, 1));
+    EXPECT_DOUBLE_EQ(0.0, arc_value(5, 4));
+    EXPECT_DOUBLE_EQ(0.0, arc_value(0, 4));
+
+    // the arc (5, 4) is the first of 5
+    EXPECT_EQ(0, arc_value.reverse(4, 1));
+}
+
+TEST(FindSubtours, TestForestWithoutSubtour)
+{
+    auto instance = connectivity_instance();
+    ArcValues arc_value(instance);
+    std::vector<double> sink_value(instance.n, 0.0);
+
+    // sink -> 0 -> 1 -> 2
+    sink_value[0] = 1;
+    arc_value.set(0, 1, 1);
+    arc_value.set(1, 2, 1);
+
+    auto subtours = connectivity::find_subtours(instance, arc_value, sink_value);
+
+    ASSERT_TRUE(subtours.empty());
+}
+
+TEST(FindSubtours, TestCycleNotConnectedToSink)
+{
+    auto instance = connectivity_instance();
+    ArcValues arc_value(instance);
+    std::vector<double> sink_value(instance.n, 0.0);
+
+    // sink -> 0 -> 1 and the cycle 4 -> 5 -> 6 -> 4
+    sink_value[0] = 1;
+    arc_value.set(0, 1, 1);
+    arc_value.set(4, 5, 1);
+    arc_value.set(5, 6, 1);
+    arc_value.set(6, 4, 1);
+
+    auto subtours = connectivity::find_subtours(instance, arc_value, sink_value);
+
+    const std::vector<std::vector<int>> expected({{4, 5, 6}});
+
+    ASSERT_EQ(expected, subtours);
+}
+
+TEST(SeparateMinCuts, TestFractionalCycle)
+{
+    auto instance = connectivity_instance();
+    ArcValues arc_value(instance);
+    std::vector<double> sink_value(instance.n, 0.0);
+    std::vector<double> demand(instance.n, 0.0);
+
+    // the triangle receives 0.5 from the sinks, but each of its nodes demands 1
+    sink_value[4] = 0.5;
+    arc_value.set(4, 5, 1);
+    arc_value.set(5, 6, 1);
+    arc_value.set(6, 4, 0.5);
+    demand[4] = demand[5] = demand[6] = 1;
+
+    auto cuts = connectivity::separate_min_cuts(instance, arc_value, sink_value, demand);
+
+    ASSERT_EQ(1, (int)cuts.size());
+    EXPECT_EQ(4, cuts[0].first);
+
+    // only the triangle and the nodes not reached by the sinks are in S
+    std::vector<int> expected({0, 1, 2, 3, 4, 5, 6});
+    EXPECT_EQ(expected, cuts[0].second);
+}
+
+TEST(SeparateMinCuts, TestConnectedSolutionHasNoCut)
+{
+    auto instance = connectivity_instance();
+    ArcValues arc_value(instance);
+    std::vector<double> sink_value(instance.n, 0.0);
+    std::vector<double> demand(instance.n, 0.0);
+
+    // sink -> 3 -> 4 -> {5, 6}
+    sink_value[3] = 1;
+    arc_value.set(3, 4, 1);
+    arc_value.set(4, 5, 1);
+    arc_value.set(4, 6, 1);
+    demand[3] = demand[4] = demand[5] = demand[6] = 1;
+
+    auto cuts = connectivity::separate_min_cuts(instance, arc_value, sink_value, demand);
+
+    ASSERT_TRUE(cuts.empty());
+}
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include "util_decomposition.h"
+#include "wsn_data.h"
+#include "test_utils.h"
+
+const double inf = std::numeric_limits<double>::infinity();
+
+TEST(ConnectedComponents, TestThreeComponents)
+{
+    int number_nodes = 6;
+    auto adj_matrix = adj_matrix_from_edges({
+        {0, 3},
+        {3, 4},
+        {1, 5}}, number_nodes);
+    auto weight = square_matrix(number_nodes, 1.0);
+
+    WSN_data instance(weight, adj_matrix, number_nodes, 3);
+
+    const std::vector<std::vector<int>> expected({{0, 3, 4}, {1, 5}, {2}});
+
+    ASSERT_EQ(expected, instance.connected_components());
+}
+
+TEST(MinMaxAllocation, TestGiveTreesToHeaviestComponent)
+{
+    // the first component gets lighter trees when it has more trees
+    std::vector<std::vector<double>> value({
+        {inf, 10, 6, 4},
+        {inf, 5, 3}});
+
+    auto allocation = decomposition::min_max_allocation(value, 4);
+
+    EXPECT_EQ(5, allocation.value);
+    EXPECT_EQ(std::vector<int>({3, 1}), allocation.trees);
+}
+
+TEST(MinMaxAllocation, TestEveryComponentHasOneTree)
+{
+    std::vector<std::vector<double>> value({
+        {inf, 10, 1},
+        {inf, 2}});
+
+    auto allocation = decomposition::min_max_allocation(value, 3);
+
+    EXPECT_EQ(2, allocation.value);
+    EXPECT_EQ(std::vector<int>({2, 1}), allocation.trees);
+}
+
+TEST(MinMaxAllocation, TestInfeasible)
+{
+    std::vector<std::vector<double>> value({
+        {inf, 1},
+        {inf, 1}});
+
+    // the components can not receive more than one tree
+    auto allocation = decomposition::min_max_allocation(value, 3);
+    EXPECT_EQ(inf, allocation.value);
+
+    // there are more components than trees
+    allocation = decomposition::min_max_allocation(value, 1);
+    EXPECT_EQ(inf, allocation.value);
+}
+
+TEST(ComponentsTable, TestNameBeforeExtension)
+{
+    EXPECT_EQ("results_components.csv", decomposition::components_table("results.csv"));
+    EXPECT_EQ("out/run.1/results_components.jsonl", decomposition::components_table("out/run.1/results.jsonl"));
+    EXPECT_EQ("out.d/results_components", decomposition::components_table("out.d/results"));
+}
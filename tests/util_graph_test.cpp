@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include "util_graph.h"
+#include "util_instance.h"
+#include "test_utils.h"
+
+// all the triples checked one by one
+std::vector<std::array<int, 3>> brute_force_ordered_triangles(std::vector<std::vector<int>> &adj_matrix)
+{
+    int n = adj_matrix.size();
+    std::vector<std::array<int, 3>> triples;
+
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            for (int k = 0; k < n; k++)
+            {
+                if ((adj_matrix[i][j] == 1) & (adj_matrix[j][k] == 1) & (adj_matrix[i][k] == 1))
+                {
+                    triples.push_back({i, j, k});
+                }
+            }
+        }
+    }
+
+    return triples;
+}
+
+TEST(ListTriangles, TestTwoTrianglesSharingEdge)
+{
+    auto adj_matrix = adj_matrix_from_edges({
+        {0, 1},
+        {1, 2},
+        {0, 2},
+        {1, 3},
+        {2, 3},
+        {3, 4}}, 5);
+
+    auto actual = list_triangles(to_adj_list_out(adj_matrix));
+
+    const std::vector<std::array<int, 3>> expected({{0, 1, 2}, {1, 2, 3}});
+
+    ASSERT_EQ(expected, actual);
+}
+
+TEST(ListTriangles, TestTreeHasNoTriangle)
+{
+    auto adj_matrix = adj_matrix_from_edges({
+        {0, 1},
+        {0, 2},
+        {2, 3}}, 4);
+
+    ASSERT_TRUE(list_triangles(to_adj_list_out(adj_matrix)).empty());
+}
+
+TEST(ListOrderedTriangles, TestSameTriplesOfBruteForce)
+{
+    int number_nodes = 40;
+    std::vector<std::vector<int>> edges;
+
+    // sparse graph with fixed edges (linear congruential generator)
+    unsigned int seed = 12345;
+    for (int i = 0; i < number_nodes; i++)
+    {
+        for (int j = i + 1; j < number_nodes; j++)
+        {
+            seed = seed * 1103515245 + 12345;
+
+            if ((seed >> 16) % 100 < 15)
+            {
+                edges.push_back({i, j});
+            }
+        }
+    }
+
+    auto adj_matrix = adj_matrix_from_edges(edges, number_nodes);
+
+    // an arc without its reverse
+    adj_matrix[edges[0][0]][edges[0][1]] = 0;
+
+    ASSERT_EQ(brute_force_ordered_triangles(adj_matrix), list_ordered_triangles(to_adj_list_out(adj_matrix)));
+}
+
+TEST(ListOrderedTriangles, TestCompleteGraph)
+{
+    int number_nodes = 6;
+    std::vector<std::vector<int>> edges;
+
+    for (int i = 0; i < number_nodes; i++)
+    {
+        for (int j = i + 1; j < number_nodes; j++)
+        {
+            edges.push_back({i, j});
+        }
+    }
+
+    auto adj_matrix = adj_matrix_from_edges(edges, number_nodes);
+
+    ASSERT_EQ(brute_force_ordered_triangles(adj_matrix), list_ordered_triangles(to_adj_list_out(adj_matrix)));
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "util_lagrangian.h"
+#include "test_utils.h"
+
+// weighted_path(7, 1): the edge (i, i + 1) has weight 2 i + 1 and the optimum for one tree is 24
+
+TEST(Lagrangian, TestZeroMultipliersGiveCombinatorialBound)
+{
+    auto instance = weighted_path(7, 1);
+
+    lagrangian::DominationRelaxation relaxation(instance);
+
+    std::vector<int> masters;
+    double value = relaxation.solve(std::vector<double>(instance.n, 0.0), masters);
+
+    EXPECT_DOUBLE_EQ(lower_bounds::combinatorial(instance).value(), value);
+    EXPECT_EQ(3, (int)masters.size());
+}
+
+TEST(Lagrangian, TestAnyMultipliersGiveLowerBound)
+{
+    auto instance = weighted_path(7, 1);
+
+    lagrangian::DominationRelaxation relaxation(instance);
+
+    std::default_random_engine rng(7);
+    std::uniform_real_distribution<double> distribution(0.0, 10.0);
+    std::vector<int> masters;
+
+    for (int sample = 0; sample < 100; sample++)
+    {
+        std::vector<double> mu(instance.n);
+        for (auto &value : mu)
+        {
+            value = distribution(rng);
+        }
+
+        EXPECT_LE(relaxation.solve(mu, masters), 24 + 1e-9);
+    }
+}
+
+TEST(Lagrangian, TestSubgradientOfUncoveredNodes)
+{
+    auto instance = weighted_path(7, 1);
+
+    lagrangian::DominationRelaxation relaxation(instance);
+
+    // node 1 dominates 0, 1 and 2, node 2 is dominated twice by 1 and 3
+    auto g = relaxation.subgradient({1, 3});
+
+    EXPECT_EQ(std::vector<double>({0, 0, -1, 0, 0, 1, 1}), g);
+}
+
+TEST(Lagrangian, TestSubgradientOptimizationIsBounded)
+{
+    auto instance = weighted_path(7, 1);
+
+    auto result = lagrangian::subgradient_optimization(instance, 24);
+
+    EXPECT_GE(result.bound, lower_bounds::combinatorial(instance).value() - 1e-9);
+    EXPECT_LE(result.bound, 24 + 1e-9);
+}
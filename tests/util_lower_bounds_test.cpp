@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include "util_lower_bounds.h"
+#include "test_utils.h"
+
+TEST(LowerBounds, TestMastersOfPath)
+{
+    auto instance = weighted_path(7, 1);
+
+    EXPECT_EQ(3, lower_bounds::masters_lower_bound(instance));
+}
+
+TEST(LowerBounds, TestMastersOfStar)
+{
+    int number_nodes = 6;
+    auto adj_matrix = adj_matrix_from_edges({{0, 1}, {0, 2}, {0, 3}, {0, 4}, {0, 5}}, number_nodes);
+    auto weight = square_matrix(number_nodes, 1.0);
+
+    WSN_data instance(weight, adj_matrix, number_nodes, 1);
+
+    auto bounds = lower_bounds::combinatorial(instance);
+
+    EXPECT_EQ(1, bounds.masters);
+    EXPECT_DOUBLE_EQ(0, bounds.value());
+}
+
+TEST(LowerBounds, TestEdgeWeightsUseLightestDirection)
+{
+    int number_nodes = 3;
+    auto adj_matrix = adj_matrix_from_edges({{0, 1}, {1, 2}}, number_nodes);
+    std::vector<std::vector<double>> weight({{0, 4, 0},
+                                             {2, 0, 1},
+                                             {0, 3, 0}});
+
+    WSN_data instance(weight, adj_matrix, number_nodes, 1);
+
+    EXPECT_EQ(std::vector<double>({1, 2}), lower_bounds::sorted_edge_weights(instance));
+}
+
+TEST(LowerBounds, TestBoundsByNumberOfTrees)
+{
+    auto one_tree = weighted_path(7, 1);
+    auto bounds = lower_bounds::combinatorial(one_tree);
+
+    // 2 arcs (1 + 3) in total and a tree with 3 masters (1 + 3 + 5), the optimum is 24
+    EXPECT_DOUBLE_EQ(4, bounds.total_weight);
+    EXPECT_DOUBLE_EQ(9, bounds.largest_tree);
+    EXPECT_DOUBLE_EQ(9, bounds.value());
+
+    auto two_trees = weighted_path(7, 2);
+    bounds = lower_bounds::combinatorial(two_trees);
+
+    EXPECT_DOUBLE_EQ(0.5, bounds.total_weight);
+    EXPECT_DOUBLE_EQ(4, bounds.largest_tree);
+
+    // every tree may have a single master
+    auto three_trees = weighted_path(7, 3);
+
+    EXPECT_DOUBLE_EQ(0, lower_bounds::combinatorial(three_trees).value());
+}
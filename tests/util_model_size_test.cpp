@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "util_model_size.h"
+#include "test_utils.h"
+
+// cycle 0-1-...-(n - 1)-0 with unit weights
+WSN_data cycle_instance(int number_nodes, int number_trees)
+{
+    std::vector<std::vector<int>> edges;
+
+    for (int i = 0; i < number_nodes; i++)
+    {
+        edges.push_back({i, (i + 1) % number_nodes});
+    }
+
+    auto adj_matrix = adj_matrix_from_edges(edges, number_nodes);
+    auto weight = square_matrix(number_nodes, 1.0);
+
+    return WSN_data(weight, adj_matrix, number_nodes, number_trees);
+}
+
+TEST(ModelSize, TestFamilies)
+{
+    using model_size::Family;
+
+    EXPECT_EQ(Family::Flow, model_size::family("FlowModel3-base"));
+    EXPECT_EQ(Family::Flow, model_size::family("MTZ-sbpo"));
+    EXPECT_EQ(Family::ThreeIndex, model_size::family("FlowModel3idx"));
+    EXPECT_EQ(Family::ThreeIndex, model_size::family("FlowModel2-1-sbc"));
+    EXPECT_EQ(Family::Commodity, model_size::family("MCFModel"));
+    EXPECT_EQ(Family::Commodity, model_size::family("MCFModel-castro2023"));
+    EXPECT_EQ(Family::SinkFlow, model_size::family("MCFModel-weightAsFlow-base"));
+    EXPECT_EQ(Family::SinkFlow, model_size::family("MCF-weight-arc-Model"));
+    EXPECT_EQ(Family::Representative, model_size::family("REPR-flow"));
+    EXPECT_EQ(Family::LabeledTree, model_size::family("MAR-lazy-cut"));
+    EXPECT_EQ(Family::Decomposition, model_size::family("Benders"));
+    EXPECT_EQ(Family::TreeColumns, model_size::family("ColumnGeneration"));
+    EXPECT_EQ(Family::Bound, model_size::family("Lagrangian"));
+
+    EXPECT_THROW(model_size::family("Unknown"), std::invalid_argument);
+}
+
+TEST(ModelSize, TestBaseColumnsCountArcs)
+{
+    auto instance = cycle_instance(10, 2);
+    auto size = model_size::estimate("Benders", instance);
+
+    // y, z, N, T, the 20 arcs of the cycle and the 2 x 10 sink arcs
+    EXPECT_EQ(2 * 10 + 2 + 20 + 20, size.columns);
+    EXPECT_EQ(2 * 10 + 12 * 10 + 2, size.variables);
+}
+
+TEST(ModelSize, TestMultiIndexModelsAreLarger)
+{
+    auto instance = cycle_instance(30, 3);
+
+    auto flow = model_size::estimate("FlowModel3-base", instance);
+    auto three_index = model_size::estimate("FlowModel3idx", instance);
+    auto commodity = model_size::estimate("MCFModel", instance);
+    auto representative = model_size::estimate("REPR-mtz", instance);
+
+    EXPECT_LT(flow.memory_mb(), three_index.memory_mb());
+    EXPECT_LT(three_index.memory_mb(), commodity.memory_mb());
+    EXPECT_LT(flow.memory_mb(), representative.memory_mb());
+
+    EXPECT_EQ(0, model_size::estimate("Lagrangian", instance).memory_mb());
+}
+
+TEST(ModelSize, TestColumnGenerationCountsThePricing)
+{
+    auto instance = cycle_instance(30, 3);
+    auto size = model_size::estimate("ColumnGeneration", instance);
+
+    // the dense arc and flow matrices of the pricing mip
+    EXPECT_LE(2 * 30 * 30, size.variables);
+    EXPECT_LT(model_size::estimate("Lagrangian", instance).memory_mb(), size.memory_mb());
+}
+
+TEST(ModelSize, TestGrowthWithTheNumberOfTrees)
+{
+    auto few_trees = cycle_instance(20, 1);
+    auto many_trees = cycle_instance(20, 4);
+
+    auto flow_ratio = model_size::estimate("FlowModel3-base", many_trees).columns /
+                      model_size::estimate("FlowModel3-base", few_trees).columns;
+    auto sink_ratio = model_size::estimate("MAR-flow", many_trees).columns /
+                      model_size::estimate("MAR-flow", few_trees).columns;
+
+    EXPECT_LT(flow_ratio, sink_ratio);
+}
+
+TEST(ModelSize, TestBudget)
+{
+    auto instance = cycle_instance(50, 2);
+    auto size = model_size::estimate("MCFModel", instance);
+
+    EXPECT_TRUE(model_size::fits(size, 0));
+    EXPECT_TRUE(model_size::fits(size, size.memory_mb() + 1));
+    EXPECT_FALSE(model_size::fits(size, size.memory_mb() / 2));
+}
+
+TEST(ModelSize, TestModelWithinBudget)
+{
+    auto instance = cycle_instance(50, 2);
+
+    double commodity = model_size::estimate("MCFModel", instance).memory_mb();
+    double flow = model_size::estimate("FlowModel3-base", instance).memory_mb();
+    double budget = (commodity + flow) / 2;
+
+    EXPECT_EQ("MCFModel", model_size::model_within_budget("MCFModel", "FlowModel3-base", instance, 0));
+    EXPECT_EQ("FlowModel3-base", model_size::model_within_budget("MCFModel", "FlowModel3-base", instance, budget));
+    EXPECT_EQ("", model_size::model_within_budget("MCFModel", "", instance, budget));
+    EXPECT_EQ("", model_size::model_within_budget("MCFModel", "FlowModel3-base", instance, flow / 2));
+
+    auto run = model_size::over_budget_run("MCFModel", instance, true);
+
+    EXPECT_EQ("OverMemoryBudget", run.status);
+    EXPECT_EQ("MCFModel", run.model);
+    EXPECT_EQ(2, run.number_trees);
+    EXPECT_TRUE(run.relaxed);
+    EXPECT_EQ((long)model_size::estimate("MCFModel", instance).columns, run.cols);
+}
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <thread>
+#include "util_perf.h"
+
+TEST(PhaseRecorder, TestPhasesAddUp)
+{
+    perf::PhaseRecorder phases;
+
+    phases.start(perf::Phase::Build);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    phases.start(perf::Phase::Solve);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    phases.start(perf::Phase::Build);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    phases.stop();
+    phases.stop();
+
+    EXPECT_GE(phases[perf::Phase::Build].time, 0.04);
+    EXPECT_GE(phases[perf::Phase::Solve].time, 0.01);
+    EXPECT_LT(phases[perf::Phase::Solve].time, phases[perf::Phase::Build].time);
+    EXPECT_EQ(0, phases[perf::Phase::Parse].time);
+    EXPECT_EQ(0, phases[perf::Phase::Parse].peak_rss_mb);
+    EXPECT_GT(phases[perf::Phase::Build].peak_rss_mb, 0);
+}
+
+TEST(PhaseRecorder, TestClear)
+{
+    perf::PhaseRecorder phases;
+
+    phases.start(perf::Phase::Parse);
+    phases.start(perf::Phase::Build);
+    phases.start(perf::Phase::Output);
+    phases.clear(perf::Phase::Build);
+
+    EXPECT_GT(phases[perf::Phase::Parse].peak_rss_mb, 0);
+    EXPECT_EQ(0, phases[perf::Phase::Build].peak_rss_mb);
+
+    // the running output was cleared, so stop records nothing
+    phases.stop();
+    EXPECT_EQ(0, phases[perf::Phase::Output].peak_rss_mb);
+}
+
+TEST(PhaseRecorder, TestMemory)
+{
+    perf::PhaseRecorder phases;
+
+    phases.start(perf::Phase::Build);
+    std::vector<char> buffer(64 * 1024 * 1024, 1);
+    phases.stop();
+
+    EXPECT_GE(phases[perf::Phase::Build].peak_rss_mb, 64);
+    EXPECT_GE(perf::memory::peak_rss_mb(), phases[perf::Phase::Build].peak_rss_mb);
+
+    if (perf::memory::heap_in_use_mb() > 0)
+    {
+        EXPECT_NEAR(64, phases[perf::Phase::Build].heap_mb, 1);
+    }
+
+    EXPECT_EQ(1, buffer[1024]);
+}
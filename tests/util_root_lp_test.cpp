@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include "util_root_lp.h"
+
+TEST(RootLp, TestWriteRead)
+{
+    root_lp::Solution s;
+    s.n = 2;
+    s.number_trees = 1;
+    s.objective = 7.5;
+    s.y_value = {1, 0};
+    s.y_reduced_cost = {0, 2.5};
+    s.z_value = {0, 0.5};
+    s.z_reduced_cost = {1, 0};
+    s.arc_from = {0, 1, 2};
+    s.arc_to = {1, 0, 0};
+    s.arc_value = {0, 1, 1};
+    s.arc_reduced_cost = {3, 0, -0.25};
+    s.duals = {1, -2, 0.5, 4};
+
+    std::string path = testing::TempDir() + "util_root_lp_test.rlp";
+    root_lp::write(path, s);
+
+    auto read = root_lp::read(path);
+
+    EXPECT_EQ(2, read.n);
+    EXPECT_EQ(1, read.number_trees);
+    EXPECT_EQ(7.5, read.objective);
+    EXPECT_EQ(s.y_value, read.y_value);
+    EXPECT_EQ(s.y_reduced_cost, read.y_reduced_cost);
+    EXPECT_EQ(s.z_value, read.z_value);
+    EXPECT_EQ(s.z_reduced_cost, read.z_reduced_cost);
+    EXPECT_EQ(s.arc_from, read.arc_from);
+    EXPECT_EQ(s.arc_to, read.arc_to);
+    EXPECT_EQ(s.arc_value, read.arc_value);
+    EXPECT_EQ(s.arc_reduced_cost, read.arc_reduced_cost);
+    EXPECT_EQ(s.duals, read.duals);
+
+    // header, 4 arrays of nodes, 2 int and 2 double arrays of arcs and the duals
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    EXPECT_EQ(4 + 4 + 8 + 8 + 16 + 4 * 2 * 8 + 3 * (4 + 4 + 8 + 8) + 4 * 8, (int)in.tellg());
+
+    std::remove(path.c_str());
+}
+
+TEST(RootLp, TestInvalidFile)
+{
+    std::string path = testing::TempDir() + "util_root_lp_test_invalid.rlp";
+    std::ofstream(path.c_str()) << "WSNB not a root lp";
+
+    EXPECT_THROW(root_lp::read(path), std::runtime_error);
+    EXPECT_THROW(root_lp::read(testing::TempDir() + "missing.rlp"), std::runtime_error);
+
+    std::remove(path.c_str());
+}
+
+TEST(RootLp, TestReducedCostFixings)
+{
+    // root LP 10 and a solution of value 12: a variable is fixed if moving it costs more than 2
+    std::vector<double> values = {0, 0, 1, 1, 0.5, 0};
+    std::vector<double> reduced_costs = {3, 1.5, -2.5, -1, 0, 2};
+
+    auto fixings = root_lp::reduced_cost_fixings(values, reduced_costs, 10, 12);
+
+    EXPECT_EQ(std::vector<int>({0, -1, 1, -1, -1, -1}), fixings);
+
+    // without a gap, every variable with a reduced cost is fixed
+    fixings = root_lp::reduced_cost_fixings(values, reduced_costs, 12, 12);
+
+    EXPECT_EQ(std::vector<int>({0, 0, 1, 1, -1, 0}), fixings);
+}
@@ -2,6 +2,7 @@
 #include "util_solution.h"
 #include "test_utils.h"
 #include "wsn_solution.h"
+#include "wsn_constructive_heur.h"
 
 TEST(SolutionIsValid, TestOneSinkValidSolution)
 {
@@ -263,6 +264,23 @@ TEST(SolutionIsValid, TestTwoSinksInvalidSolutionCycle)
     ASSERT_EQ(expected, actual);
 }
 
+TEST(SolutionIsValid, TestHeuristicSolutionWithNodeLists)
+{
+    int number_nodes = 6;
+    auto adj_matrix = adj_matrix_from_edges({{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 5}}, number_nodes);
+    auto weight = square_matrix(number_nodes, 1.0);
+
+    WSN_data instance(weight, adj_matrix, number_nodes, 1);
+
+    WSNConstructiveHeuristic heur(instance);
+    auto sol = with_node_lists(heur.solve(0));
+
+    WSN_solution checker(instance);
+
+    EXPECT_TRUE(checker.is_valid(sol.edges, sol.masters, sol.bridges));
+    EXPECT_EQ(sol.edges.size(), sol.masters.size() + sol.bridges.size() - 1);
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+#include "util_solver_params.h"
+
+TEST(SolverParams, TestDefaults)
+{
+    SolverParams params;
+
+    EXPECT_EQ(600, params.time_limit);
+    EXPECT_EQ(0, params.threads);
+    EXPECT_EQ(0, params.parallel_mode);
+    EXPECT_EQ(-1, params.node_file);
+    EXPECT_TRUE(params.work_dir.empty());
+    EXPECT_EQ(0, params.lp_method);
+    EXPECT_EQ(0, params.crossover);
+}
+
+TEST(SolverParams, TestParallelMode)
+{
+    EXPECT_EQ(0, solver_params::parallel_mode("auto"));
+    EXPECT_EQ(1, solver_params::parallel_mode("deterministic"));
+    EXPECT_EQ(-1, solver_params::parallel_mode("opportunistic"));
+    EXPECT_THROW(solver_params::parallel_mode("fast"), std::invalid_argument);
+}
+
+TEST(SolverParams, TestNodeFile)
+{
+    EXPECT_EQ(0, solver_params::node_file("none"));
+    EXPECT_EQ(1, solver_params::node_file("memory"));
+    EXPECT_EQ(2, solver_params::node_file("disk"));
+    EXPECT_EQ(3, solver_params::node_file("disk-compressed"));
+    EXPECT_THROW(solver_params::node_file("2"), std::invalid_argument);
+}
+
+TEST(SolverParams, TestLpMethod)
+{
+    EXPECT_EQ(0, solver_params::lp_method("auto"));
+    EXPECT_EQ(2, solver_params::lp_method("dual"));
+    EXPECT_EQ(4, solver_params::lp_method("barrier"));
+    EXPECT_EQ(6, solver_params::lp_method("concurrent"));
+    EXPECT_THROW(solver_params::lp_method("simplex"), std::invalid_argument);
+}
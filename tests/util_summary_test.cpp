@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include "util_summary.h"
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+std::vector<std::string> read_lines(std::string path)
+{
+    std::ifstream in(path.c_str());
+    std::vector<std::string> lines;
+    std::string line;
+
+    while (std::getline(in, line))
+    {
+        lines.push_back(line);
+    }
+
+    return lines;
+}
+
+RunSummary example_summary()
+{
+    RunSummary s;
+    s.time_now = "2023-01-01 10:00:00";
+    s.instance = "instance_1";
+    s.n = 10;
+    s.model = "FlowModel3-base";
+    s.number_trees = 2;
+    s.build_time = 0.5;
+    s.solve_time = 1.25;
+    s.status = "Optimal";
+    s.objective = 10;
+    s.best_bound = 10;
+    s.gap = 0;
+    s.nodes = 3;
+    s.rows = 4;
+    s.cols = 5;
+    s.nonzeros = 6;
+    s.valid = 1;
+
+    return s;
+}
+
+TEST(RunSummary, TestCsvRow)
+{
+    auto actual = summary::to_csv(example_summary());
+
+    const std::string expected = "2023-01-01 10:00:00,instance_1,10,FlowModel3-base,2,0,0.5,1.25,Optimal,10,10,0,3,4,5,6,1,,0"
+                                 ",0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0";
+
+    ASSERT_EQ(expected, actual);
+}
+
+TEST(RunSummary, TestCsvRowHasAColumnPerHeader)
+{
+    auto s = example_summary();
+    s.peak_rss_mb = 120;
+    s.phases[(int)perf::Phase::Build] = {2, 100, 50};
+
+    auto header = summary::split_csv_row(summary::csv_header());
+    auto row = summary::split_csv_row(summary::to_csv(s));
+
+    ASSERT_EQ(header.size(), row.size());
+
+    for (int i = 0; i < (int)header.size(); i++)
+    {
+        if (header[i] == "build_rss_mb")
+        {
+            EXPECT_EQ("100", row[i]);
+            EXPECT_EQ("build_time", header[i - 1]);
+            EXPECT_EQ("2", row[i - 1]);
+        }
+    }
+
+    EXPECT_NE(std::string::npos, summary::to_json(s).find("\"build\": {\"time\": 2, \"rss_mb\": 100, \"heap_mb\": 50}"));
+}
+
+TEST(RunSummary, TestCsvQuoteFields)
+{
+    ASSERT_EQ("a", summary::csv_field("a"));
+    ASSERT_EQ("\"a,b\"", summary::csv_field("a,b"));
+    ASSERT_EQ("\"a\"\"b\"", summary::csv_field("a\"b"));
+}
+
+TEST(RunSummary, TestJsonWithoutSolution)
+{
+    RunSummary s;
+    s.model = "MTZ";
+    s.relaxed = true;
+
+    auto actual = summary::to_json(s);
+
+    EXPECT_NE(std::string::npos, actual.find("\"model\": \"MTZ\""));
+    EXPECT_NE(std::string::npos, actual.find("\"relaxed\": true"));
+    EXPECT_NE(std::string::npos, actual.find("\"objective\": null"));
+    EXPECT_NE(std::string::npos, actual.find("\"valid\": null"));
+}
+
+TEST(RunSummary, TestAppendWriteHeaderOnce)
+{
+    std::string path = testing::TempDir() + "util_summary_test.csv";
+    std::remove(path.c_str());
+
+    summary::append(path, example_summary());
+    summary::append(path, example_summary());
+
+    auto lines = read_lines(path);
+    std::remove(path.c_str());
+
+    ASSERT_EQ(3, (int)lines.size());
+    EXPECT_EQ(summary::csv_header(), lines[0]);
+    EXPECT_EQ(summary::to_csv(example_summary()), lines[1]);
+    EXPECT_EQ(lines[1], lines[2]);
+}
+
+TEST(RunSummary, TestAppendRejectsOtherColumns)
+{
+    std::string path = testing::TempDir() + "util_summary_old_columns.csv";
+    std::ofstream(path.c_str()) << "time_now,instance,n,model,K\n";
+
+    EXPECT_THROW(summary::append(path, example_summary()), std::runtime_error);
+
+    auto lines = read_lines(path);
+    std::remove(path.c_str());
+
+    EXPECT_EQ(1, (int)lines.size());
+}
+
+TEST(RunSummary, TestAppendJsonLines)
+{
+    std::string path = testing::TempDir() + "util_summary_test.jsonl";
+    std::remove(path.c_str());
+
+    summary::append(path, example_summary());
+
+    auto lines = read_lines(path);
+    std::remove(path.c_str());
+
+    ASSERT_EQ(1, (int)lines.size());
+    EXPECT_EQ(summary::to_json(example_summary()), lines[0]);
+}
+
+TEST(RunSummary, TestSplitCsvRow)
+{
+    auto fields = summary::split_csv_row("a,\"b,c\",,\"d\"\"e\"");
+
+    ASSERT_EQ(4, (int)fields.size());
+    EXPECT_EQ("a", fields[0]);
+    EXPECT_EQ("b,c", fields[1]);
+    EXPECT_EQ("", fields[2]);
+    EXPECT_EQ("d\"e", fields[3]);
+}
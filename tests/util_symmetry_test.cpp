@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include "util_symmetry.h"
+
+TEST(Symmetry, TestOrdering)
+{
+    EXPECT_EQ(symmetry::Ordering::None, symmetry::ordering("none"));
+    EXPECT_EQ(symmetry::Ordering::Root, symmetry::ordering("root"));
+    EXPECT_EQ(symmetry::Ordering::Tree, symmetry::ordering("tree"));
+    EXPECT_EQ("tree", symmetry::ordering_name(symmetry::Ordering::Tree));
+    EXPECT_EQ("formulation", symmetry::ordering_name(symmetry::Ordering::Formulation));
+
+    EXPECT_THROW(symmetry::ordering("smallest"), std::invalid_argument);
+}
+
+TEST(Symmetry, TestOrderedTreesHaveNoViolatedRows)
+{
+    // trees {0, 3}, {1, 4} and {2}, ordered by their smallest node
+    std::vector<std::vector<double>> keys = {{1, 0, 0, 1, 0},
+                                             {0, 1, 0, 0, 1},
+                                             {0, 0, 1, 0, 0}};
+
+    EXPECT_TRUE(symmetry::violated_rows(keys).empty());
+
+    // the empty trees are the last ones
+    keys.push_back({0, 0, 0, 0, 0});
+
+    EXPECT_TRUE(symmetry::violated_rows(keys).empty());
+}
+
+TEST(Symmetry, TestViolatedRows)
+{
+    // trees {1, 4} and {0, 3}, the second one has the smallest node
+    std::vector<std::vector<double>> keys = {{0, 1, 0, 0, 1},
+                                             {1, 0, 0, 1, 0}};
+
+    auto violated = symmetry::violated_rows(keys);
+
+    ASSERT_EQ(1, (int)violated.size());
+    EXPECT_EQ(1, violated[0].tree);
+    EXPECT_EQ(0, violated[0].node);
+    EXPECT_DOUBLE_EQ(1, violated[0].violation);
+
+    // an empty tree before a non empty one
+    keys = {{0, 0, 0}, {0, 1, 0}};
+
+    violated = symmetry::violated_rows(keys);
+
+    ASSERT_EQ(1, (int)violated.size());
+    EXPECT_EQ(1, violated[0].node);
+}
+
+TEST(Symmetry, TestViolatedRowsOfFractionalPoint)
+{
+    std::vector<std::vector<double>> keys = {{0.5, 0, 0.5},
+                                             {0.25, 0.5, 0.25}};
+
+    auto violated = symmetry::violated_rows(keys);
+
+    // node 0: 0.25 > 0, node 1: 0.5 <= 0.5, node 2: 0.25 <= 0.5
+    ASSERT_EQ(1, (int)violated.size());
+    EXPECT_EQ(0, violated[0].node);
+    EXPECT_DOUBLE_EQ(0.25, violated[0].violation);
+
+    keys[1] = {0.5, 0.75, 0};
+
+    violated = symmetry::violated_rows(keys);
+
+    ASSERT_EQ(2, (int)violated.size());
+    EXPECT_EQ(0, violated[0].node);
+    EXPECT_EQ(1, violated[1].node);
+    EXPECT_DOUBLE_EQ(0.25, violated[1].violation);
+}
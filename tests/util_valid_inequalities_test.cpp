@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include "util_valid_inequalities.h"
+#include "test_utils.h"
+
+using namespace valid_inequalities;
+
+// star with center 0 and leaves 1, 2 and 3
+WSN_data star_instance()
+{
+    int number_nodes = 4;
+    auto adj_matrix = adj_matrix_from_edges({
+        {0, 1},
+        {0, 2},
+        {0, 3}}, number_nodes);
+    auto weight = square_matrix(number_nodes, 1.0);
+
+    return WSN_data(weight, adj_matrix, number_nodes, 1);
+}
+
+TEST(ValidInequalities, TestFeasibleSolutionIsNotCut)
+{
+    auto instance = star_instance();
+    ArcValues x(instance);
+    std::vector<double> y({1, 0, 0, 0});
+    std::vector<double> z({0, 0, 0, 0});
+
+    auto violated = violated_castro_andrade2023(instance, {CastroAndrade2023_12, CastroAndrade2023_15, CastroAndrade2023_16, CastroAndrade2023_17}, x, y, z);
+
+    ASSERT_TRUE(violated.empty());
+}
+
+TEST(ValidInequalities, TestViolatedArcInequalities)
+{
+    auto instance = star_instance();
+    ArcValues x(instance);
+    std::vector<double> y({0.5, 0, 0, 0});
+    std::vector<double> z({0, 0.5, 0, 0});
+
+    x.set(0, 1, 1);
+
+    auto violated = violated_castro_andrade2023(instance, {CastroAndrade2023_15, CastroAndrade2023_16, CastroAndrade2023_17}, x, y, z);
+
+    const std::vector<Inequality> expected({
+        {CastroAndrade2023_15, 0, 1},
+        {CastroAndrade2023_16, 0, 1},
+        {CastroAndrade2023_17, 0, 1},
+        {CastroAndrade2023_15, 1, 0}});
+
+    ASSERT_EQ(expected, violated);
+}
+
+TEST(ValidInequalities, TestOnlySelectedFamilies)
+{
+    auto instance = star_instance();
+    ArcValues x(instance);
+    std::vector<double> y({0, 0, 0, 0});
+    std::vector<double> z({0, 0, 0, 1});
+
+    auto violated = violated_castro_andrade2023(instance, {CastroAndrade2023_12}, x, y, z);
+
+    const std::vector<Inequality> expected({{CastroAndrade2023_12, 3, -1}});
+
+    ASSERT_EQ(expected, violated);
+}
+
+TEST(InequalityPool, TestInsertOnce)
+{
+    InequalityPool pool;
+
+    ASSERT_TRUE(pool.insert({CastroAndrade2023_16, 0, 1}));
+    ASSERT_TRUE(pool.insert({CastroAndrade2023_17, 0, 1}));
+    ASSERT_FALSE(pool.insert({CastroAndrade2023_16, 0, 1}));
+    ASSERT_EQ(2, pool.size());
+}
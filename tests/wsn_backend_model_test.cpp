@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <map>
+#include "backend/wsn_backend_model.h"
+#include "test_utils.h"
+
+// backend that only records the model, the values are given by the tests
+class RecordingBackend : public backend::MipBackend
+{
+public:
+    std::map<std::string, int> index;
+    std::vector<backend::Row> rows;
+    backend::LazyRowGenerator generator;
+
+    std::string name() override { return "Recording"; }
+
+    int add_variable(double /*lb*/, double /*ub*/, backend::VarType /*type*/, const std::string &name) override
+    {
+        index[name] = index.size();
+        return index.size() - 1;
+    }
+
+    void add_row(const backend::Row &row) override { rows.push_back(row); }
+    void set_objective(const backend::LinearExpr & /*expr*/, backend::Sense /*sense*/) override {}
+    void set_lazy_rows(backend::LazyRowGenerator _generator) override { generator = _generator; }
+
+    backend::Status solve(double /*time_limit*/, int /*threads*/) override { return backend::Status::NoSolution; }
+
+    double value(int /*variable*/) override { return 0; }
+    double objective_value() override { return 0; }
+    double best_bound() override { return 0; }
+    long nodes() override { return 0; }
+
+    int number_variables() override { return index.size(); }
+    int number_rows() override { return rows.size(); }
+
+    // values of the variables, all zero apart from the given ones
+    std::vector<double> values(std::map<std::string, double> nonzero)
+    {
+        std::vector<double> values(index.size(), 0.0);
+
+        for (auto &[name, value] : nonzero)
+        {
+            values[index.at(name)] = value;
+        }
+
+        return values;
+    }
+
+    int violated_rows(const std::vector<double> &values)
+    {
+        int violated = 0;
+
+        for (auto &row : rows)
+        {
+            double activity = 0;
+            for (auto &[variable, coefficient] : row.expr)
+            {
+                activity += coefficient * values[variable];
+            }
+
+            violated += (activity < row.lb - 1e-9 || activity > row.ub + 1e-9) ? 1 : 0;
+        }
+
+        return violated;
+    }
+};
+
+TEST(BackendModel, TestTrivialTreesSatisfyModel)
+{
+    auto instance = weighted_path(6, 2);
+    RecordingBackend solver;
+
+    WSN_backend_model model(instance, solver);
+    model.build_model();
+
+    // masters 1 and 4, each one connected to a sink
+    auto values = solver.values({{"y(1)", 1}, {"y(4)", 1}, {"x(6)(1)", 1}, {"x(7)(4)", 1}, {"N", 2}});
+
+    EXPECT_EQ(0, solver.violated_rows(values));
+    EXPECT_TRUE(solver.generator(values).empty());
+}
+
+TEST(BackendModel, TestHeavyTreeGivesOptimalityCut)
+{
+    auto instance = weighted_path(6, 1);
+    RecordingBackend solver;
+
+    WSN_backend_model model(instance, solver);
+    model.build_model();
+
+    // tree 1 -> 2 -> 3 -> 4 -> 5 with masters 1, 3, 5 and weight 3 + 5 + 7 + 9
+    std::map<std::string, double> solution = {{"y(1)", 1}, {"y(3)", 1}, {"y(5)", 1}, {"z(2)", 1}, {"z(4)", 1},
+                                              {"x(1)(2)", 1}, {"x(2)(3)", 1}, {"x(3)(4)", 1}, {"x(4)(5)", 1},
+                                              {"x(6)(1)", 1}, {"N", 5}, {"T", 24}};
+
+    auto values = solver.values(solution);
+
+    EXPECT_EQ(0, solver.violated_rows(values));
+    EXPECT_TRUE(solver.generator(values).empty());
+
+    // T is the weight of the heaviest out star, the cut sets it to the weight of the tree
+    solution["T"] = 16;
+    values = solver.values(solution);
+
+    EXPECT_EQ(0, solver.violated_rows(values));
+
+    auto cuts = solver.generator(values);
+    ASSERT_EQ(1, (int)cuts.size());
+
+    double activity = 0;
+    for (auto &[variable, coefficient] : cuts.front().expr)
+    {
+        activity += coefficient * values[variable];
+    }
+
+    // T - sum c(a) x(a) >= W - sum c(a), violated by the weight of the tree minus T
+    EXPECT_DOUBLE_EQ(24 - 16, cuts.front().lb - activity);
+}
+
+TEST(BackendModel, TestSubtourGivesConnectivityCut)
+{
+    auto instance = weighted_path(6, 1);
+    RecordingBackend solver;
+
+    WSN_backend_model model(instance, solver);
+    model.build_model();
+
+    // the tree of master 1 is connected to the sink, the tree 3 -> 4 -> 5 is not
+    auto values = solver.values({{"x(6)(1)", 1}, {"x(3)(4)", 1}, {"x(4)(5)", 1}, {"y(1)", 1}, {"y(3)", 1}, {"y(5)", 1}, {"z(4)", 1}});
+
+    auto cuts = solver.generator(values);
+    ASSERT_FALSE(cuts.empty());
+
+    double activity = 0;
+    for (auto &[variable, coefficient] : cuts.front().expr)
+    {
+        activity += coefficient * values[variable];
+    }
+
+    EXPECT_LT(activity, cuts.front().lb);
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <cmath>
+#include "wsn_generator.h"
+#include "wsn_data.h"
+
+generator::GeometricParams small_network(unsigned long long seed)
+{
+    generator::GeometricParams params;
+    params.n = 60;
+    params.area = 100;
+    params.range = 25;
+    params.seed = seed;
+
+    return params;
+}
+
+TEST(Generator, TestSameSeedSameNetwork)
+{
+    auto a = generator::random_geometric(small_network(7));
+    auto b = generator::random_geometric(small_network(7));
+    auto c = generator::random_geometric(small_network(8));
+
+    ASSERT_EQ(a.edges.size(), b.edges.size());
+    EXPECT_EQ(a.position, b.position);
+
+    for (size_t e = 0; e < a.edges.size(); e++)
+    {
+        EXPECT_EQ(a.edges[e].from, b.edges[e].from);
+        EXPECT_EQ(a.edges[e].to, b.edges[e].to);
+        EXPECT_EQ(a.edges[e].weight, b.edges[e].weight);
+    }
+
+    EXPECT_NE(a.position, c.position);
+}
+
+TEST(Generator, TestEdgesWithinRange)
+{
+    auto params = small_network(1);
+    auto network = generator::random_geometric(params);
+
+    int pairs_in_range = 0;
+
+    for (int i = 0; i < network.n; i++)
+    {
+        for (int j = i + 1; j < network.n; j++)
+        {
+            double dx = network.position[i].first - network.position[j].first;
+            double dy = network.position[i].second - network.position[j].second;
+
+            pairs_in_range += (dx * dx + dy * dy <= params.range * params.range) ? 1 : 0;
+        }
+    }
+
+    EXPECT_EQ(pairs_in_range, (int)network.edges.size());
+
+    for (auto &edge : network.edges)
+    {
+        EXPECT_LT(edge.from, edge.to);
+        EXPECT_LE(edge.weight, params.range + 0.005);
+    }
+}
+
+TEST(Generator, TestEnergyIsSquaredDistance)
+{
+    auto params = small_network(3);
+    auto distance = generator::random_geometric(params);
+
+    params.weight = generator::WeightModel::Energy;
+    auto energy = generator::random_geometric(params);
+
+    ASSERT_EQ(distance.edges.size(), energy.edges.size());
+
+    for (size_t e = 0; e < energy.edges.size(); e++)
+    {
+        EXPECT_NEAR(distance.edges[e].weight * distance.edges[e].weight, energy.edges[e].weight, 0.02 * params.range + 0.01);
+    }
+}
+
+TEST(Generator, TestTextAndBinaryAreTheSameInstance)
+{
+    auto network = generator::random_geometric(small_network(11));
+    auto path = (std::filesystem::temp_directory_path() / "wsn_generator_test").string();
+
+    generator::write_network(network, path);
+
+    WSN_data text(path + ".txt");
+    WSN_data binary(path + ".wsnb");
+
+    EXPECT_EQ(network.n, text.n);
+    EXPECT_EQ(text.n, binary.n);
+    EXPECT_EQ(text.is_connected, binary.is_connected);
+    EXPECT_EQ(text.weight, binary.weight);
+
+    std::filesystem::remove(path + ".txt");
+    std::filesystem::remove(path + ".wsnb");
+}
+
+TEST(Generator, TestComponents)
+{
+    generator::SensorNetwork network;
+    network.n = 5;
+    network.edges = {{0, 1, 1.0}, {1, 2, 1.0}, {3, 4, 1.0}};
+
+    EXPECT_EQ(2, generator::number_of_components(network));
+}
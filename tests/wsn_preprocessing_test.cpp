@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "wsn_preprocessing.h"
+#include "wsn_solution.h"
+#include "test_utils.h"
+
+// path 0-1-2-3, isolated node 4 and the pair 5-6
+WSN_data instance_with_trivial_components(int number_trees)
+{
+    int number_nodes = 7;
+    auto adj_matrix = adj_matrix_from_edges({
+        {0, 1},
+        {1, 2},
+        {2, 3},
+        {5, 6}}, number_nodes);
+    auto weight = square_matrix(number_nodes, 1.0);
+
+    return WSN_data(weight, adj_matrix, number_nodes, number_trees);
+}
+
+TEST(WSNReduction, TestRemoveTrivialComponents)
+{
+    auto instance = instance_with_trivial_components(3);
+
+    WSN_reduction reduction(instance);
+
+    ASSERT_TRUE(reduction.is_reduced());
+    EXPECT_EQ(4, reduction.reduced_instance().n);
+    EXPECT_EQ(1, reduction.reduced_instance().number_trees);
+    EXPECT_EQ(std::vector<int>({0, 1, 2, 3}), reduction.original_node);
+    EXPECT_EQ(std::vector<int>({4, 5}), reduction.removed_masters);
+}
+
+TEST(WSNReduction, TestKeepOneTreeToOtherComponents)
+{
+    auto instance = instance_with_trivial_components(2);
+
+    WSN_reduction reduction(instance);
+
+    EXPECT_EQ(1, (int)reduction.removed_masters.size());
+    EXPECT_EQ(1, reduction.reduced_instance().number_trees);
+    EXPECT_EQ(6, reduction.reduced_instance().n);
+}
+
+TEST(WSNReduction, TestFixings)
+{
+    auto instance = instance_with_trivial_components(3);
+
+    WSN_reduction reduction(instance);
+
+    // every arc of the path can join a master and a bridge
+    EXPECT_EQ(std::vector<int>({0, 3}), reduction.not_bridge);
+    EXPECT_TRUE(reduction.fixed_arcs.empty());
+}
+
+TEST(WSNReduction, TestFixedArcsOfClique)
+{
+    // triangle 0-1-2 and the leaf 3 of 2
+    int number_nodes = 4;
+    auto adj_matrix = adj_matrix_from_edges({{0, 1}, {0, 2}, {1, 2}, {2, 3}}, number_nodes);
+    auto weight = square_matrix(number_nodes, 1.0);
+
+    WSN_data instance(weight, adj_matrix, number_nodes, 1);
+
+    WSN_reduction reduction(instance);
+
+    // 2 is a bridge between 3 and 0 or 1, which are adjacent and can not be bridges
+    const std::vector<std::pair<int, int>> expected_arcs({{0, 1}, {1, 0}});
+
+    EXPECT_EQ(std::vector<int>({0, 1, 3}), reduction.not_bridge);
+    EXPECT_EQ(expected_arcs, reduction.fixed_arcs);
+}
+
+TEST(WSNReduction, TestLiftedSolutionIsValid)
+{
+    auto instance = instance_with_trivial_components(3);
+
+    WSN_reduction reduction(instance);
+
+    // masters 0 and 2 connected by the bridge 1
+    std::vector<std::vector<int>> edges({{0, 1}, {1, 2}});
+    std::vector<int> masters({0, 2});
+    std::vector<int> bridges({1});
+
+    WSN_solution reduced_checker(reduction.reduced_instance());
+    ASSERT_TRUE(reduced_checker.is_valid(edges, masters, bridges));
+
+    reduction.lift(edges, masters, bridges);
+
+    WSN_solution original_checker(instance);
+    ASSERT_TRUE(original_checker.is_valid(edges, masters, bridges));
+}